@@ -5,13 +5,20 @@
 #include "USDCameraFrameRangesStyle.h"
 #include "USDCameraFrameRangesCommands.h"
 #include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Input/SSpinBox.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
 #include "ToolMenus.h"
 #include "USDStageActor.h"
 #include "CineCameraActor.h"
 #include "Kismet/GameplayStatics.h"
 #include "Editor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ScopedTransaction.h"
 
 #include "LevelSequence.h"
 #include "MovieScene.h"
@@ -25,21 +32,448 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/usd/attribute.h"
 #include "pxr/base/vt/value.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/relationship.h"
+#include "pxr/usd/usdGeom/camera.h"
+#include "pxr/usd/usdGeom/gprim.h"
+#include "pxr/usd/usdGeom/mesh.h"
+#include "pxr/usd/usdGeom/subset.h"
+#include "pxr/usd/usdGeom/tokens.h"
 #include "pxr/usd/usdGeom/xform.h"
+#include "pxr/usd/usdShade/material.h"
+#include "pxr/usd/usdShade/materialBindingAPI.h"
+#include "pxr/usd/usdShade/shader.h"
+#include "pxr/usd/usdShade/tokens.h"
 #include "USDIncludesEnd.h"
 
-#include "Engine/ObjectLibrary.h"
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Materials/Material.h"
 #include "Tracks/MovieScene3DTransformTrack.h"
 #include "Sections/MovieScene3DTransformSection.h"
 #include "CineCameraComponent.h"
 #include "UsdAttributeFunctionLibraryBPLibrary.h"
 #include "Sections/MovieSceneFloatSection.h"
 #include "Tracks/MovieSceneFloatTrack.h"
+#include "Channels/MovieSceneDoubleChannel.h"
+#include "Channels/MovieSceneFloatChannel.h"
+#include "USDKeyReduction.h"
 
 static const FName USDCameraFrameRangesTabName("USDCameraFrameRanges");
 
 #define LOCTEXT_NAMESPACE "FUSDCameraFrameRangesModule"
 
+namespace USDCameraFrameRangesImpl
+{
+	/** Below this many cameras, extracting them on the game thread is cheaper than waking workers. */
+	constexpr int32 MinCamerasForParallelExtraction = 4;
+
+	const FName CameraNameColumn(TEXT("CameraName"));
+	const FName FrameRangeColumn(TEXT("FrameRange"));
+	const FName CameraMainRangeColumn(TEXT("CameraMainRange"));
+	const FName DuplicateColumn(TEXT("Duplicate"));
+
+	/**
+	 * @brief Formats every frame range cameraMain cuts to a camera for, or n/a if it never does.
+	 */
+	FString FormatCameraMainRanges(const FCameraInfo& Camera)
+	{
+		if (!Camera.inCameraMain)
+		{
+			return TEXT("n/a");
+		}
+
+		return FString::JoinBy(Camera.CameraMainRanges, TEXT(", "), [](const FInt32Interval& Range)
+		{
+			return FString::Printf(TEXT("%d - %d"), Range.Min, Range.Max);
+		});
+	}
+
+	/**
+	 * @class SCameraRow
+	 * @brief A row of the camera list, reading its columns from the camera record it shows.
+	 */
+	class SCameraRow : public SMultiColumnTableRow<TSharedPtr<FCameraInfo>>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SCameraRow) {}
+			SLATE_ARGUMENT(TSharedPtr<FCameraInfo>, Camera)
+			SLATE_EVENT(FOnClicked, OnDuplicateClicked)
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTableView)
+		{
+			Camera = InArgs._Camera;
+			OnDuplicateClicked = InArgs._OnDuplicateClicked;
+			SMultiColumnTableRow<TSharedPtr<FCameraInfo>>::Construct(FSuperRowType::FArguments(), OwnerTableView);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			// The text is read from the record when painted, so rows show edits to it without being rebuilt
+			TSharedPtr<FCameraInfo> RowCamera = Camera;
+			if (ColumnName == CameraNameColumn)
+			{
+				return SNew(STextBlock)
+					.Text_Lambda([RowCamera]() { return FText::FromString(RowCamera->CameraName); });
+			}
+			if (ColumnName == FrameRangeColumn)
+			{
+				return SNew(STextBlock)
+					.Text_Lambda([RowCamera]() { return FText::FromString(FString::Printf(TEXT("%d - %d"), RowCamera->StartFrame, RowCamera->EndFrame)); });
+			}
+			if (ColumnName == CameraMainRangeColumn)
+			{
+				return SNew(STextBlock)
+					.Text_Lambda([RowCamera]() { return FText::FromString(FormatCameraMainRanges(*RowCamera)); });
+			}
+			if (ColumnName == DuplicateColumn)
+			{
+				return SNew(SBox)
+					.HAlign(HAlign_Left)
+					[
+						SNew(SButton)
+						.Text(FText::FromString(TEXT("Duplicate")))
+						.OnClicked(OnDuplicateClicked)
+					];
+			}
+			return SNullWidget::NullWidget;
+		}
+
+	private:
+		TSharedPtr<FCameraInfo> Camera;
+		FOnClicked OnDuplicateClicked;
+	};
+
+	/**
+	 * @brief Reads a float attribute directly off a prim at the given time.
+	 * 
+	 * @return The value, or 0 if the attribute is missing or not a float.
+	 */
+	float GetFloatAttribute(const pxr::UsdPrim& Prim, const pxr::TfToken& AttrName, double Time)
+	{
+		float Value = 0.0f;
+		if (pxr::UsdAttribute Attr = Prim.GetAttribute(AttrName))
+		{
+			Attr.Get(&Value, pxr::UsdTimeCode(Time));
+		}
+		return Value;
+	}
+
+	/**
+	 * @brief Finds the start and end frame of a camera from the time samples of its translation and rotation.
+	 * 
+	 * @param CameraInfo The camera, whose time samples have been read.
+	 */
+	void ComputeFrameRange(FCameraInfo& CameraInfo)
+	{
+		if (CameraInfo.RotTimeSamples.Num() > 1 || CameraInfo.TransTimeSamples.Num() > 1)
+		{
+			// Use whichever attribute has the most samples. The first sample is skipped unless the
+			// second is on frame 2, as exports from Maya key a frame before the shot starts
+			const TArray<double>& TimeSamples = CameraInfo.RotTimeSamples.Num() > CameraInfo.TransTimeSamples.Num()
+				? CameraInfo.RotTimeSamples
+				: CameraInfo.TransTimeSamples;
+
+			if (TimeSamples.Num() > 1)
+			{
+				CameraInfo.StartFrame = TimeSamples[1] == 2.0 ? TimeSamples[0] : TimeSamples[1];
+			}
+			else
+			{
+				CameraInfo.StartFrame = TimeSamples[0];
+			}
+			CameraInfo.EndFrame = TimeSamples.Last();
+		}
+		else
+		{
+			CameraInfo.StartFrame = 1;
+			CameraInfo.EndFrame = 1;
+		}
+	}
+
+	/**
+	 * @brief Finds the cameraNumber attribute of a prim named cameraMain.
+	 * 
+	 * @param Prim The prim to check.
+	 * @return The prim's cameraNumber attribute, which is invalid if the prim isn't cameraMain.
+	 */
+	UE::FUsdAttribute GetCameraMainNumber(const pxr::UsdPrim& Prim)
+	{
+		static const pxr::TfToken CameraMainToken("cameraMain");
+		static const pxr::TfToken CameraNumberToken("cameraNumber");
+
+		if (Prim.GetName() != CameraMainToken)
+		{
+			return UE::FUsdAttribute();
+		}
+		return UE::FUsdAttribute(Prim.GetAttribute(CameraNumberToken));
+	}
+
+	/**
+	 * @brief Checks whether a stage traversal visits a prim before the prims of a subtree it isn't part of.
+	 * 
+	 * @param Stage The stage both prims are on.
+	 * @param Path The path of the prim to check, which must not be under Root.
+	 * @param Root The root of the subtree.
+	 * @return True if the prim is one of Root's ancestors, or comes before Root in its parent's child order.
+	 */
+	bool PrecedesSubtree(const pxr::UsdStageRefPtr& Stage, const pxr::SdfPath& Path, const pxr::SdfPath& Root)
+	{
+		if (Root.HasPrefix(Path))
+		{
+			return true;
+		}
+
+		// Otherwise the paths descend from different children of their common ancestor, visited in child order
+		const pxr::SdfPath Parent = Path.GetCommonPrefix(Root);
+		auto GetChildName = [&Parent](pxr::SdfPath Descendant)
+		{
+			while (Descendant.GetParentPath() != Parent)
+			{
+				Descendant = Descendant.GetParentPath();
+			}
+			return Descendant.GetNameToken();
+		};
+		const pxr::TfToken PathChild = GetChildName(Path);
+		const pxr::TfToken RootChild = GetChildName(Root);
+
+		const pxr::UsdPrim ParentPrim = Stage->GetPrimAtPath(Parent);
+		if (!ParentPrim)
+		{
+			return Path < Root;
+		}
+		for (const pxr::TfToken& Name : ParentPrim.GetChildrenNames())
+		{
+			if (Name == PathChild)
+			{
+				return true;
+			}
+			if (Name == RootChild)
+			{
+				return false;
+			}
+		}
+		return Path < Root;
+	}
+
+	/**
+	 * @brief Reads a camera's transform time samples, frame range and intrinsics from the prim.
+	 * 
+	 * @param Prim The camera prim.
+	 * @param OutCameraInfo The camera information to fill in.
+	 * @return False if the camera is missing its translation or rotation.
+	 */
+	bool ExtractCameraInfo(const pxr::UsdPrim& Prim, FCameraInfo& OutCameraInfo)
+	{
+		static const pxr::TfToken TranslateToken("xformOp:translate");
+		static const pxr::TfToken RotateToken("xformOp:rotateXYZ");
+
+		OutCameraInfo.CameraName = UTF8_TO_TCHAR(Prim.GetName().GetText());
+		OutCameraInfo.PrimPath = UE::FSdfPath(Prim.GetPath());
+		OutCameraInfo.Translation = UE::FUsdAttribute(Prim.GetAttribute(TranslateToken));
+		OutCameraInfo.Rotation = UE::FUsdAttribute(Prim.GetAttribute(RotateToken));
+
+		if (!OutCameraInfo.Rotation || !OutCameraInfo.Translation)
+		{
+			return false;
+		}
+
+		OutCameraInfo.Rotation.GetTimeSamples(OutCameraInfo.RotTimeSamples);
+		OutCameraInfo.Translation.GetTimeSamples(OutCameraInfo.TransTimeSamples);
+		ComputeFrameRange(OutCameraInfo);
+
+		// Intrinsics are read at frame 1, as they are not animated in practice
+		OutCameraInfo.FocalLength = GetFloatAttribute(Prim, pxr::UsdGeomTokens->focalLength, 1.0);
+		OutCameraInfo.FocusDistance = GetFloatAttribute(Prim, pxr::UsdGeomTokens->focusDistance, 1.0);
+		OutCameraInfo.FStop = GetFloatAttribute(Prim, pxr::UsdGeomTokens->fStop, 1.0);
+		OutCameraInfo.HorizontalAperture = GetFloatAttribute(Prim, pxr::UsdGeomTokens->horizontalAperture, 1.0);
+		OutCameraInfo.VerticalAperture = GetFloatAttribute(Prim, pxr::UsdGeomTokens->verticalAperture, 1.0);
+		return true;
+	}
+
+	/**
+	 * @brief Reads a Vec3 attribute at each of the given times, directly off the attribute.
+	 * 
+	 * @param Attr The attribute, authored as a float3, double3 or half3.
+	 * @param Times The times to read it at.
+	 * @param OutValues Receives one value per time, which is zero where the value couldn't be read.
+	 */
+	void GetVec3TimeSamples(const UE::FUsdAttribute& Attr, const TArray<double>& Times, TArray<FVector>& OutValues)
+	{
+		OutValues.SetNumZeroed(Times.Num());
+		if (!Attr)
+		{
+			return;
+		}
+
+		const pxr::UsdAttribute& UsdAttr = static_cast<const pxr::UsdAttribute&>(Attr);
+		pxr::VtValue Value;
+		for (int32 Index = 0; Index < Times.Num(); ++Index)
+		{
+			if (!UsdAttr.Get(&Value, pxr::UsdTimeCode(Times[Index])))
+			{
+				continue;
+			}
+
+			if (Value.IsHolding<pxr::GfVec3f>())
+			{
+				OutValues[Index] = UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3f>(Value);
+			}
+			else if (Value.IsHolding<pxr::GfVec3d>())
+			{
+				OutValues[Index] = UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3d>(Value);
+			}
+			else if (Value.IsHolding<pxr::GfVec3h>())
+			{
+				OutValues[Index] = UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3h>(Value);
+			}
+		}
+	}
+
+	/**
+	 * @brief Collects the shaders of the materials bound to gprims and their GeomSubsets.
+	 *
+	 * Every gprim and each of its materialBind subsets is resolved in a single batched
+	 * UsdShadeMaterialBindingAPI::ComputeBoundMaterials call, which follows inherited and collection
+	 * bindings and falls back from preview to all purpose bindings. Subsets are given the material slot
+	 * of their order on the mesh, and the gprim's own binding the slot after them for the faces outside
+	 * every subset, matching how meshes with subsets are split into sections on import. That slot only
+	 * exists when some faces aren't in any subset, so it is skipped when the subsets cover the whole mesh.
+	 *
+	 * This is specifically looking for materials under 'Shader' in the Usd.
+	 * Out of Maya, this is after the shading group which appears as mtl. This may need
+	 * adjustments for different workflows.
+	 * 
+	 * @param Gprims The gprims whose material bindings are read.
+	 * @param OutMaterials Array to store the material information found.
+	 */
+	void CollectMaterialBindings(const TArray<pxr::UsdPrim>& Gprims, TArray<FMaterialInfo>& OutMaterials)
+	{
+		std::vector<pxr::UsdPrim> BindingPrims;
+		TArray<int32> GprimIndices;
+		TArray<int32> MaterialSlots;
+		BindingPrims.reserve(Gprims.Num());
+		GprimIndices.Reserve(Gprims.Num());
+		MaterialSlots.Reserve(Gprims.Num());
+
+		for (int32 GprimIndex = 0; GprimIndex < Gprims.Num(); ++GprimIndex)
+		{
+			const pxr::UsdPrim& Gprim = Gprims[GprimIndex];
+			const std::vector<pxr::UsdGeomSubset> Subsets = pxr::UsdShadeMaterialBindingAPI(Gprim).GetMaterialBindSubsets();
+			for (size_t SubsetIndex = 0; SubsetIndex < Subsets.size(); ++SubsetIndex)
+			{
+				BindingPrims.push_back(Subsets[SubsetIndex].GetPrim());
+				GprimIndices.Add(GprimIndex);
+				MaterialSlots.Add(static_cast<int32>(SubsetIndex));
+			}
+
+			// Subsets can only be checked for coverage on meshes, other gprims keep their own slot
+			const pxr::UsdGeomMesh Mesh(Gprim);
+			if (Subsets.empty() || !Mesh || !pxr::UsdGeomSubset::GetUnassignedIndices(Subsets, Mesh.GetFaceCount()).empty())
+			{
+				BindingPrims.push_back(Gprim);
+				GprimIndices.Add(GprimIndex);
+				MaterialSlots.Add(static_cast<int32>(Subsets.size()));
+			}
+		}
+
+		const std::vector<pxr::UsdShadeMaterial> BoundMaterials = pxr::UsdShadeMaterialBindingAPI::ComputeBoundMaterials(BindingPrims, pxr::UsdShadeTokens->preview);
+
+		for (size_t BindingIndex = 0; BindingIndex < BoundMaterials.size(); ++BindingIndex)
+		{
+			const pxr::UsdShadeMaterial& BoundMaterial = BoundMaterials[BindingIndex];
+			if (!BoundMaterial)
+			{
+				continue;
+			}
+
+			const pxr::UsdPrim& Gprim = Gprims[GprimIndices[BindingIndex]];
+			for (const pxr::UsdPrim& ChildPrim : BoundMaterial.GetPrim().GetChildren())
+			{
+				if (ChildPrim.IsA<pxr::UsdShadeShader>())
+				{
+					FMaterialInfo& MaterialInfo = OutMaterials.AddDefaulted_GetRef();
+					MaterialInfo.ObjName = UTF8_TO_TCHAR(BindingPrims[BindingIndex].GetName().GetText());
+					MaterialInfo.MatName = UTF8_TO_TCHAR(ChildPrim.GetName().GetText());
+					MaterialInfo.PrimPath = UE::FSdfPath(Gprim.GetPath());
+					MaterialInfo.MaterialSlot = MaterialSlots[BindingIndex];
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Replaces the keys of a channel in one operation, rather than adding them one at a time.
+	 * 
+	 * Every sample becomes a constant key, unless a tolerance is given, in which case samples that can be
+	 * reproduced within it by held or linear keys are dropped.
+	 * 
+	 * @param Channel The channel to fill.
+	 * @param Frames The frame of each sample, in increasing order.
+	 * @param Values The value of each sample.
+	 * @param Tolerance The error allowed when reducing keys, or 0 to key every sample.
+	 * @param Stats Accumulates the number of samples and of keys written.
+	 */
+	template <typename ChannelValueType, typename ChannelType, typename ValueType>
+	void SetKeys(ChannelType& Channel, const TArray<FFrameNumber>& Frames, TArrayView<const ValueType> Values, double Tolerance, UsdKeyReduction::FKeyReductionStats& Stats)
+	{
+		check(Frames.Num() == Values.Num());
+
+		TArray<FFrameNumber> KeyFrames;
+		TArray<ChannelValueType> KeyValues;
+
+		if (Tolerance > 0.0)
+		{
+			TArray<double> SampleTimes;
+			TArray<double> SampleValues;
+			SampleTimes.Reserve(Frames.Num());
+			SampleValues.Reserve(Values.Num());
+			for (int32 Index = 0; Index < Frames.Num(); ++Index)
+			{
+				SampleTimes.Add(Frames[Index].Value);
+				SampleValues.Add(Values[Index]);
+			}
+
+			TArray<UsdKeyReduction::FReducedKey> ReducedKeys;
+			UsdKeyReduction::ReduceKeys(SampleTimes, SampleValues, Tolerance, ReducedKeys);
+
+			KeyFrames.Reserve(ReducedKeys.Num());
+			KeyValues.Reserve(ReducedKeys.Num());
+			for (const UsdKeyReduction::FReducedKey& Key : ReducedKeys)
+			{
+				KeyFrames.Add(Frames[Key.SampleIndex]);
+				KeyValues.Emplace_GetRef(Values[Key.SampleIndex]).InterpMode = Key.InterpMode;
+			}
+		}
+		else
+		{
+			KeyFrames = Frames;
+			KeyValues.Reserve(Values.Num());
+			for (const ValueType Value : Values)
+			{
+				KeyValues.Emplace_GetRef(Value).InterpMode = RCIM_Constant;
+			}
+		}
+
+		Stats.KeysBefore += Values.Num();
+		Stats.KeysAfter += KeyValues.Num();
+		Channel.Set(MoveTemp(KeyFrames), MoveTemp(KeyValues));
+	}
+
+	void SetKeys(FMovieSceneDoubleChannel& Channel, const TArray<FFrameNumber>& Frames, TArrayView<const double> Values, double Tolerance, UsdKeyReduction::FKeyReductionStats& Stats)
+	{
+		SetKeys<FMovieSceneDoubleValue>(Channel, Frames, Values, Tolerance, Stats);
+	}
+
+	void SetKeys(FMovieSceneFloatChannel& Channel, const TArray<FFrameNumber>& Frames, TArrayView<const float> Values, double Tolerance, UsdKeyReduction::FKeyReductionStats& Stats)
+	{
+		SetKeys<FMovieSceneFloatValue>(Channel, Frames, Values, Tolerance, Stats);
+	}
+}
+
+
 void FUSDCameraFrameRangesModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -77,6 +511,14 @@ void FUSDCameraFrameRangesModule::ShutdownModule()
 	FUSDCameraFrameRangesCommands::Unregister();
 
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(USDCameraFrameRangesTabName);
+
+	if (MaterialSwapHandle.IsValid())
+	{
+		MaterialSwapHandle->CancelHandle();
+		MaterialSwapHandle.Reset();
+	}
+
+	StageActorEvents.Unbind();
 }
 
 void FUSDCameraFrameRangesModule::RegisterMenus()
@@ -125,6 +567,8 @@ TSharedRef<SDockTab> FUSDCameraFrameRangesModule::OnSpawnPluginTab(const FSpawnT
     StageActor = FindUsdStageActor();
     if (!StageActor)
     {
+        StageActorEvents.Unbind();
+
         // If the Usd stage actor is not found, display a message
         return SNew(SDockTab)
             .TabRole(ETabRole::NomadTab)
@@ -145,9 +589,8 @@ TSharedRef<SDockTab> FUSDCameraFrameRangesModule::OnSpawnPluginTab(const FSpawnT
     TSharedPtr<SEditableTextBox> PrimInputTextBox = SNew(SEditableTextBox);
     TSharedPtr<SEditableTextBox> AttrInputTextBox = SNew(SEditableTextBox);
 
-    // Create vertical boxes for level sequence buttons and camera list
+    // Create the vertical box for level sequence buttons
     TSharedPtr<SVerticalBox> LevelSequenceButtons = SNew(SVerticalBox);
-    TSharedPtr<SVerticalBox> CameraList = SNew(SVerticalBox);
 
     // Add input fields with labels to the level sequence buttons
     LevelSequenceButtons->AddSlot()
@@ -167,6 +610,28 @@ TSharedRef<SDockTab> FUSDCameraFrameRangesModule::OnSpawnPluginTab(const FSpawnT
         [
             SequenceInputTextBox.ToSharedRef()
         ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(5)
+        [
+            SNew(STextBlock)
+            .Text(FText::FromString(TEXT("Key reduction tolerance:")))
+            .ToolTipText(FText::FromString(TEXT("Keys that can be reproduced within this tolerance, in cm or degrees, are dropped when baking. 0 keys every frame.")))
+        ]
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(5)
+        [
+            SNew(SBox)
+            .WidthOverride(80.0f)
+            [
+                SNew(SSpinBox<float>)
+                .MinValue(0.0f)
+                .Delta(0.01f)
+                .Value_Lambda([this]() { return KeyReductionTolerance; })
+                .OnValueChanged_Lambda([this](float NewValue) { KeyReductionTolerance = NewValue; })
+            ]
+        ]
     ];
 
     // Add prim name and attribute name fields on the same row
@@ -213,158 +678,423 @@ TSharedRef<SDockTab> FUSDCameraFrameRangesModule::OnSpawnPluginTab(const FSpawnT
         ]
     ];
 
-    // Add header for the camera list
-    CameraList->AddSlot()
-    .Padding(2)
-    [
-        SNew(SHorizontalBox)
-        + SHorizontalBox::Slot()
-        .FillWidth(0.25)
-        [
-            SNew(STextBlock)
-            .Text(FText::FromString(TEXT("Camera name")))
-        ]
-        + SHorizontalBox::Slot()
-        .FillWidth(0.25)
-        [
-            SNew(STextBlock)
-            .Text(FText::FromString("Frame range"))
-        ]
-    	+ SHorizontalBox::Slot()
-	    .FillWidth(0.25)
-        [
-            SNew(STextBlock)
-            .Text(FText::FromString("Camera Main Frame Range"))
-        ]
-        + SHorizontalBox::Slot()
-        .AutoWidth()
-        [
-            SNew(STextBlock)
-            .Text(FText::FromString(TEXT("Create CineCameraActor")))
-        ]
-    ];
-
-	// Retrieve camera information from the Usd stage
-	TArray<FCameraInfo> Cameras = GetCamerasFromUSDStage();
-	if (Cameras.Num() == 0)
-	{
-		// If no cameras are found, display a message
-		CameraList->AddSlot()
-		.Padding(2)
-			[
-				SNew(SVerticalBox)
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				[
-					SNew(STextBlock)
-					.Text(FText::FromString(TEXT("No cameras found in the USD Stage. Please ensure there are cameras in the USD Stage.")))
-				]
-			];
-	}
-	else
-	{
-		FindCameraMainFrameRanges(Cameras);
-
-		// Loop through Cameras array and create a row widget for each camera
-		for (const FCameraInfo& Camera : Cameras)
-		{
-			CameraList->AddSlot()
-			.Padding(2)
-			[
-				SNew(SVerticalBox)
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				[
-					SNew(SHorizontalBox)
-					+ SHorizontalBox::Slot()
-					.FillWidth(0.25)
-					[
-						SNew(STextBlock)
-						.Text(FText::FromString(Camera.CameraName))
-					]
-					+ SHorizontalBox::Slot()
-					.FillWidth(0.25)
-					[
-						SNew(STextBlock)
-						.Text(FText::FromString(FString::Printf(TEXT("%d - %d"), Camera.StartFrame, Camera.EndFrame)))
-					]
-					+ SHorizontalBox::Slot()
-					.FillWidth(0.25)
-					[
-						Camera.inCameraMain ? SNew(STextBlock)
-							.Text(FText::FromString(FString::Printf(TEXT("%d - %d"), Camera.CameraMainStartFrame, Camera.CameraMainEndFrame)))
-						: SNew(STextBlock)
-							.Text(FText::FromString("n/a"))
-					]
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					[
-						SNew(SButton)
-						.Text(FText::FromString(TEXT("Duplicate")))
-						.OnClicked_Lambda([this, Camera, SequenceInputTextBox]()
-						{
-							return OnDuplicateButtonClicked(Camera, SequenceInputTextBox->GetText().ToString());
-						})
-					]
-				]
-			];
-		}
-	}
-
-    // Create and return the final tab layout with scroll boxes and buttons
+	// Retrieve camera information from the Usd stage, then keep it up to date from the stage actor's events while the tab is open
+	RebuildCameraRecords();
+	BindStageActorEvents();
+	CameraFilterText.Reset();
+	LevelSequencePathTextBox = SequenceInputTextBox;
+
+	using namespace USDCameraFrameRangesImpl;
+
+	CameraListView = SNew(SListView<TSharedPtr<FCameraInfo>>)
+		.ListItemsSource(&FilteredCameraRecords)
+		.SelectionMode(ESelectionMode::Multi)
+		.OnGenerateRow_Raw(this, &FUSDCameraFrameRangesModule::OnGenerateCameraRow)
+		.HeaderRow
+		(
+			SNew(SHeaderRow)
+			+ SHeaderRow::Column(CameraNameColumn)
+			.DefaultLabel(FText::FromString(TEXT("Camera name")))
+			.FillWidth(0.25f)
+			.SortMode_Lambda([this]() { return CameraSortColumn == CameraNameColumn ? CameraSortMode : EColumnSortMode::None; })
+			.OnSort_Raw(this, &FUSDCameraFrameRangesModule::OnCameraListSorted)
+			+ SHeaderRow::Column(FrameRangeColumn)
+			.DefaultLabel(FText::FromString(TEXT("Frame range")))
+			.FillWidth(0.25f)
+			.SortMode_Lambda([this]() { return CameraSortColumn == FrameRangeColumn ? CameraSortMode : EColumnSortMode::None; })
+			.OnSort_Raw(this, &FUSDCameraFrameRangesModule::OnCameraListSorted)
+			+ SHeaderRow::Column(CameraMainRangeColumn)
+			.DefaultLabel(FText::FromString(TEXT("Camera Main Frame Range")))
+			.FillWidth(0.25f)
+			.SortMode_Lambda([this]() { return CameraSortColumn == CameraMainRangeColumn ? CameraSortMode : EColumnSortMode::None; })
+			.OnSort_Raw(this, &FUSDCameraFrameRangesModule::OnCameraListSorted)
+			+ SHeaderRow::Column(DuplicateColumn)
+			.DefaultLabel(FText::FromString(TEXT("Create CineCameraActor")))
+			.FillWidth(0.25f)
+		);
+
+	RefreshCameraList();
+
+    // Create and return the final tab layout, the camera list filling the space between the inputs and the buttons
     return SNew(SDockTab)
         .TabRole(ETabRole::NomadTab)
+        .OnTabClosed_Lambda([this](TSharedRef<SDockTab>)
+        {
+            StageActorEvents.Unbind();
+        })
         [
-            SNew(SScrollBox)
-            + SScrollBox::Slot()
+            SNew(SVerticalBox)
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(20)
             [
-                SNew(SVerticalBox)
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                .Padding(20)
-                [
-                    LevelSequenceButtons.ToSharedRef()
-                ]
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                .Padding(20)
+                LevelSequenceButtons.ToSharedRef()
+            ]
+            + SVerticalBox::Slot()
+            .FillHeight(1.0f)
+            .Padding(20)
+            [
+                SNew(SBorder)
+                .Padding(FMargin(20))
                 [
-                    SNew(SScrollBox)
-                    + SScrollBox::Slot()
+                    SNew(SVerticalBox)
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
+                    .Padding(0, 0, 0, 5)
                     [
-                        SNew(SBorder)
-                        .Padding(FMargin(20))
-                        [
-                            CameraList.ToSharedRef()
-                        ]
+                        SNew(SSearchBox)
+                        .HintText(FText::FromString(TEXT("Filter cameras")))
+                        .OnTextChanged_Lambda([this](const FText& NewText)
+                        {
+                            CameraFilterText = NewText.ToString();
+                            RefreshCameraList();
+                        })
                     ]
-                ]
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                .Padding(10)
-                [
-                    SNew(SHorizontalBox)
-                    + SHorizontalBox::Slot()
-                    .AutoWidth()
-                    .Padding(10)
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
                     [
-                        SNew(SButton)
-                        .Text(FText::FromString(TEXT("Material swap")))
-                        .OnClicked(FOnClicked::CreateRaw(this, &FUSDCameraFrameRangesModule::OnMaterialSwapButtonClicked))
+                        SNew(STextBlock)
+                        .Text(FText::FromString(TEXT("No cameras found in the USD Stage. Please ensure there are cameras in the USD Stage.")))
+                        .Visibility_Lambda([this]() { return CameraRecords.Num() == 0 ? EVisibility::Visible : EVisibility::Collapsed; })
                     ]
-                    + SHorizontalBox::Slot()
-                    .AutoWidth()
-                    .Padding(10)
+                    + SVerticalBox::Slot()
+                    .FillHeight(1.0f)
                     [
-                        SNew(SButton)
-                        .Text(FText::FromString(TEXT("Disable Manual Focus")))
-                        .OnClicked(FOnClicked::CreateRaw(this, &FUSDCameraFrameRangesModule::OnDisableManualFocusButtonClicked))
+                        CameraListView.ToSharedRef()
                     ]
                 ]
             ]
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding(10)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                .Padding(10)
+                [
+                    SNew(SButton)
+                    .Text(FText::FromString(TEXT("Duplicate selected")))
+                    .ToolTipText(FText::FromString(TEXT("Duplicates every selected camera, baking them all into the level sequence in one undoable step")))
+                    .IsEnabled_Lambda([this]() { return CameraListView.IsValid() && CameraListView->GetNumItemsSelected() > 0; })
+                    .OnClicked_Lambda([this, SequenceInputTextBox]()
+                    {
+                        // Duplicate in the order the cameras are listed
+                        TArray<FCameraInfo> SelectedCameras;
+                        for (const TSharedPtr<FCameraInfo>& Camera : FilteredCameraRecords)
+                        {
+                            if (CameraListView->IsItemSelected(Camera))
+                            {
+                                SelectedCameras.Add(*Camera);
+                            }
+                        }
+                        return OnDuplicateSelectedButtonClicked(MoveTemp(SelectedCameras), SequenceInputTextBox->GetText().ToString());
+                    })
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                .Padding(10)
+                [
+                    SNew(SButton)
+                    .Text(FText::FromString(TEXT("Material swap")))
+                    .OnClicked(FOnClicked::CreateRaw(this, &FUSDCameraFrameRangesModule::OnMaterialSwapButtonClicked))
+                ]
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                .Padding(10)
+                [
+                    SNew(SButton)
+                    .Text(FText::FromString(TEXT("Disable Manual Focus")))
+                    .OnClicked(FOnClicked::CreateRaw(this, &FUSDCameraFrameRangesModule::OnDisableManualFocusButtonClicked))
+                ]
+            ]
         ];
 }
 
+
+/**
+ * @brief Builds the row widget for a camera when it scrolls into view.
+ * 
+ * @param Camera The camera record shown by the row.
+ * @param OwnerTable The list view that owns the row.
+ * @return The row widget.
+ */
+TSharedRef<ITableRow> FUSDCameraFrameRangesModule::OnGenerateCameraRow(TSharedPtr<FCameraInfo> Camera, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(USDCameraFrameRangesImpl::SCameraRow, OwnerTable)
+		.Camera(Camera)
+		.OnDuplicateClicked_Lambda([this, Camera]()
+		{
+			const FString LevelSequencePath = LevelSequencePathTextBox.IsValid() ? LevelSequencePathTextBox->GetText().ToString() : FString();
+			return OnDuplicateButtonClicked(*Camera, LevelSequencePath);
+		});
+}
+
+
+/**
+ * @brief Sorts the camera list by a column when its header is clicked.
+ * 
+ * @param SortPriority Unused, the list is only sorted by one column.
+ * @param ColumnId The column to sort by.
+ * @param NewSortMode Whether to sort ascending or descending.
+ */
+void FUSDCameraFrameRangesModule::OnCameraListSorted(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+	CameraSortColumn = ColumnId;
+	CameraSortMode = NewSortMode;
+	RefreshCameraList();
+}
+
+
+/**
+ * @brief Rebuilds the cameras shown by the list from the camera records, applying the text filter and sort column.
+ * Only the item array is rebuilt, the list view then builds rows for the cameras on screen.
+ */
+void FUSDCameraFrameRangesModule::RefreshCameraList()
+{
+	using namespace USDCameraFrameRangesImpl;
+
+	FilteredCameraRecords.Reset(CameraRecords.Num());
+	for (const TSharedPtr<FCameraInfo>& Camera : CameraRecords)
+	{
+		if (CameraFilterText.IsEmpty() || Camera->CameraName.Contains(CameraFilterText))
+		{
+			FilteredCameraRecords.Add(Camera);
+		}
+	}
+
+	if (CameraSortMode != EColumnSortMode::None)
+	{
+		const bool bAscending = CameraSortMode == EColumnSortMode::Ascending;
+		auto SortBy = [this, bAscending](auto Key)
+		{
+			FilteredCameraRecords.StableSort([bAscending, &Key](const TSharedPtr<FCameraInfo>& A, const TSharedPtr<FCameraInfo>& B)
+			{
+				return bAscending ? Key(*A) < Key(*B) : Key(*B) < Key(*A);
+			});
+		};
+
+		if (CameraSortColumn == CameraNameColumn)
+		{
+			SortBy([](const FCameraInfo& Camera) { return Camera.CameraName; });
+		}
+		else if (CameraSortColumn == FrameRangeColumn)
+		{
+			SortBy([](const FCameraInfo& Camera) { return TPair<int32, int32>(Camera.StartFrame, Camera.EndFrame); });
+		}
+		else if (CameraSortColumn == CameraMainRangeColumn)
+		{
+			// Cameras that cameraMain never cuts to sort after those it does
+			SortBy([](const FCameraInfo& Camera) { return Camera.CameraMainRanges.Num() > 0 ? Camera.CameraMainRanges[0].Min : MAX_int32; });
+		}
+	}
+
+	if (CameraListView.IsValid())
+	{
+		CameraListView->RequestListRefresh();
+	}
+}
+
+
+/**
+ * @brief Scans the whole stage for cameras and cameraMain, replacing every camera record.
+ * Used when the tab opens and when the stage actor opens a different stage.
+ */
+void FUSDCameraFrameRangesModule::RebuildCameraRecords()
+{
+	FUsdStageScan Scan = ScanStage(EUsdStageScanContents::Cameras);
+	CameraMainNumber = Scan.CameraMainNumber;
+
+	// The list view shares the records with its rows, so only the rows on screen are ever built
+	CameraRecords.Reset(Scan.Cameras.Num());
+	CameraRecordsByPath.Reset();
+	for (FCameraInfo& Camera : Scan.Cameras)
+	{
+		TSharedPtr<FCameraInfo> Record = MakeShared<FCameraInfo>(MoveTemp(Camera));
+		CameraRecordsByPath.Add(static_cast<const pxr::SdfPath&>(Record->PrimPath), Record);
+		CameraRecords.Add(MoveTemp(Record));
+	}
+
+	FindCameraMainFrameRanges(CameraRecords, CameraMainNumber);
+}
+
+
+/**
+ * @brief Binds to the stage actor's events, so the camera records follow stage reloads and prim edits.
+ */
+void FUSDCameraFrameRangesModule::BindStageActorEvents()
+{
+	FUsdStageActorEventBinding::FHandlers Handlers;
+
+	// A new stage has been opened (or the current one closed), so every record is out of date
+	Handlers.OnStageChanged = [this]()
+	{
+		RebuildCameraRecords();
+		RefreshCameraList();
+	};
+
+	Handlers.OnPrimChanged = [this](const FString& PrimPath, bool bResync)
+	{
+		HandlePrimChanged(PrimPath, bResync);
+	};
+
+	Handlers.OnActorDestroyed = [this]()
+	{
+		StageActorEvents.Unbind();
+		StageActor = nullptr;
+		CameraMainNumber = UE::FUsdAttribute();
+		CameraRecords.Reset();
+		CameraRecordsByPath.Reset();
+		RefreshCameraList();
+	};
+
+	StageActorEvents.Bind(StageActor, MoveTemp(Handlers));
+}
+
+
+/**
+ * @brief Updates the camera records affected by an edit to the stage.
+ *
+ * An edit to a camera's attributes only re-reads that camera, updating its record in place so that only its
+ * row shows the change. A resync drops the records under the resynced prim and scans just that subtree for
+ * cameras, and for cameraMain if the stage had none, as the rest of the stage is unchanged. The subtree's
+ * cameras are inserted where the traversal visits it, so the records stay in stage order. Only a resync of
+ * cameraMain itself or one of its ancestors scans the whole stage for it again. The cameraMain ranges are
+ * recomputed, which is a single pass over its samples, when cameraMain is edited or a camera is added or removed. The list only rebuilds its items when cameras are added or removed,
+ * or when the edited values are what it is sorted by.
+ *
+ * @param PrimPath The path of the changed prim, or of the changed property.
+ * @param bResync Whether the prim's subtree was recomposed, rather than only its values changed.
+ */
+void FUSDCameraFrameRangesModule::HandlePrimChanged(const FString& PrimPath, bool bResync)
+{
+	using namespace USDCameraFrameRangesImpl;
+
+	if (!StageActor)
+	{
+		return;
+	}
+
+	pxr::UsdStageRefPtr Stage{ StageActor->GetUsdStage() };
+	if (!Stage)
+	{
+		return;
+	}
+
+	const pxr::SdfPath ChangedPath = pxr::SdfPath(TCHAR_TO_UTF8(*PrimPath)).GetAbsoluteRootOrPrimPath();
+	if (ChangedPath.IsEmpty())
+	{
+		return;
+	}
+
+	const pxr::UsdAttribute& UsdCameraMainNumber = static_cast<const pxr::UsdAttribute&>(CameraMainNumber);
+	bool bCamerasChanged = false;
+	bool bCameraMainChanged = false;
+
+	if (bResync)
+	{
+		if (ChangedPath.IsAbsoluteRootPath())
+		{
+			RebuildCameraRecords();
+			RefreshCameraList();
+			return;
+		}
+
+		// Drop the records of the cameras under the resynced prim, which may have been removed or replaced
+		bCamerasChanged = CameraRecords.RemoveAll([this, &ChangedPath](const TSharedPtr<FCameraInfo>& Record)
+		{
+			const pxr::SdfPath& RecordPath = static_cast<const pxr::SdfPath&>(Record->PrimPath);
+			if (RecordPath.HasPrefix(ChangedPath))
+			{
+				CameraRecordsByPath.Remove(RecordPath);
+				return true;
+			}
+			return false;
+		}) > 0;
+
+		// cameraMain has to be looked for across the whole stage again if it was in the subtree. If the stage had
+		// none, the only place one can have been added is the subtree, which is searched along with the cameras
+		const bool bCameraMainResynced = CameraMainNumber && UsdCameraMainNumber.GetPrimPath().HasPrefix(ChangedPath);
+		const bool bFindCameraMainInSubtree = !CameraMainNumber;
+
+		// Then read the cameras now in the subtree, which are added where the traversal visits it so the
+		// records keep the order a full rebuild would give them
+		TArray<TSharedPtr<FCameraInfo>> SubtreeRecords;
+		if (const pxr::UsdPrim ChangedPrim = Stage->GetPrimAtPath(ChangedPath))
+		{
+			for (const pxr::UsdPrim& Prim : pxr::UsdPrimRange(ChangedPrim))
+			{
+				if (bFindCameraMainInSubtree && !CameraMainNumber)
+				{
+					CameraMainNumber = GetCameraMainNumber(Prim);
+					bCameraMainChanged = static_cast<bool>(CameraMainNumber);
+				}
+
+				if (!Prim.IsA<pxr::UsdGeomCamera>())
+				{
+					continue;
+				}
+
+				TSharedPtr<FCameraInfo> Record = MakeShared<FCameraInfo>();
+				if (ExtractCameraInfo(Prim, *Record))
+				{
+					CameraRecordsByPath.Add(Prim.GetPath(), Record);
+					SubtreeRecords.Add(MoveTemp(Record));
+				}
+			}
+		}
+
+		if (!SubtreeRecords.IsEmpty())
+		{
+			const int32 InsertIndex = Algo::LowerBound(CameraRecords, ChangedPath, [&Stage](const TSharedPtr<FCameraInfo>& Record, const pxr::SdfPath& Root)
+			{
+				return PrecedesSubtree(Stage, static_cast<const pxr::SdfPath&>(Record->PrimPath), Root);
+			});
+			CameraRecords.Insert(MoveTemp(SubtreeRecords), InsertIndex);
+			bCamerasChanged = true;
+		}
+
+		if (bCameraMainResynced)
+		{
+			CameraMainNumber = ScanStage(EUsdStageScanContents::None).CameraMainNumber;
+			bCameraMainChanged = true;
+		}
+	}
+	else if (const TSharedPtr<FCameraInfo>* Record = CameraRecordsByPath.Find(ChangedPath))
+	{
+		// Re-read the camera into its existing record, which its row reads from
+		const pxr::UsdPrim CameraPrim = Stage->GetPrimAtPath(ChangedPath);
+		FCameraInfo UpdatedCamera;
+		if (CameraPrim && ExtractCameraInfo(CameraPrim, UpdatedCamera))
+		{
+			UpdatedCamera.CameraMainRanges = MoveTemp((*Record)->CameraMainRanges);
+			UpdatedCamera.inCameraMain = (*Record)->inCameraMain;
+			**Record = MoveTemp(UpdatedCamera);
+		}
+	}
+	else if (CameraMainNumber && UsdCameraMainNumber.GetPrimPath() == ChangedPath)
+	{
+		bCameraMainChanged = true;
+	}
+	else
+	{
+		// Not a camera or cameraMain, so nothing shown by the tab changed
+		return;
+	}
+
+	if (bCamerasChanged || bCameraMainChanged)
+	{
+		FindCameraMainFrameRanges(CameraRecords, CameraMainNumber);
+	}
+
+	// Rows read from their records when painted, so the list only needs its items rebuilt when they, or their order, change
+	if (bCamerasChanged || CameraSortMode != EColumnSortMode::None)
+	{
+		RefreshCameraList();
+	}
+}
+
+
 /**
  * @brief Finds the first Usd Stage Actor in the current level.
  * Searches for an AUsdStageActor in the current editor world context.
@@ -415,28 +1145,24 @@ TObjectPtr<AUsdStageActor> FUSDCameraFrameRangesModule::FindUsdStageActor()
 
 
 /**
- * @brief Handles the event when the duplicate button is clicked.
- * Spawns a new CineCameraActor, sets its properties based on the found Usd camera information,
- * and adds it to the specified level sequence if a path is provided.
- * 
- * @param Camera The camera information to duplicate.
- * @param LevelSequencePath The path to the level sequence where the new camera should be added.
- * @return FReply Indicates that the event has been handled.
- */
-FReply FUSDCameraFrameRangesModule::OnDuplicateButtonClicked(FCameraInfo Camera, FString LevelSequencePath)
-{
-    UE_LOG(LogTemp, Log, TEXT("Duplicate button clicked for camera: %s"), *Camera.CameraName);
-
-    // Get the current editor world
-    UWorld* World =  GEditor->GetEditorWorldContext().World();
-
+ * @brief Spawns a new CineCameraActor and sets its properties based on the found Usd camera information.
+ * The transform is taken from the first frame, the animation being baked separately into a level sequence.
+ * It is read off the attributes the stage scan found for the camera's prim, so cameras sharing a name each
+ * get their own transform.
+ * 
+ * @param World The world to spawn the camera in.
+ * @param Camera The camera information to duplicate.
+ * @return The new camera, or nullptr if it couldn't be spawned.
+ */
+TObjectPtr<ACineCameraActor> FUSDCameraFrameRangesModule::SpawnDuplicateCamera(UWorld* World, const FCameraInfo& Camera)
+{
     // Spawn a new CineCameraActor
     TObjectPtr<ACineCameraActor> NewCameraActor = World->SpawnActor<ACineCameraActor>();
 
     if (!NewCameraActor)
     {
         UE_LOG(LogTemp, Warning, TEXT("Failed to spawn new CineCameraActor"));
-        return FReply::Handled();
+        return nullptr;
     }
 
     // Set the label for the new camera
@@ -446,11 +1172,14 @@ FReply FUSDCameraFrameRangesModule::OnDuplicateButtonClicked(FCameraInfo Camera,
     UE_LOG(LogTemp, Log, TEXT("New camera created with label: %s"), *NewCameraActor->GetActorLabel());
     UE_LOG(LogTemp, Log, TEXT("Camera name: %s"), *NewCameraActor->GetName());
 
-    // Retrieve the translation value from the Usd attribute
-    UE::FVtValue Value;
-    UE_LOG(LogTemp, Log, TEXT("Getting value"));
-    FVector Translation = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3Attribute(StageActor, Camera.CameraName, "xformOp:translate", 0.0);
-    UE_LOG(LogTemp, Log, TEXT("Value received"));
+    // Retrieve the translation and rotation values from the camera's Usd attributes
+    const TArray<double> FirstFrame = { 0.0 };
+    TArray<FVector> Translations;
+    TArray<FVector> Rotations;
+    USDCameraFrameRangesImpl::GetVec3TimeSamples(Camera.Translation, FirstFrame, Translations);
+    USDCameraFrameRangesImpl::GetVec3TimeSamples(Camera.Rotation, FirstFrame, Rotations);
+
+    const FVector& Translation = Translations[0];
 
     if (Translation == FVector::ZeroVector)
     {
@@ -461,8 +1190,7 @@ FReply FUSDCameraFrameRangesModule::OnDuplicateButtonClicked(FCameraInfo Camera,
     FVector CameraLocation(Translation[0], Translation[2], Translation[1]);
     NewCameraActor->SetActorLocation(CameraLocation);
 
-    // Retrieve the rotation value from the Usd attribute
-    FVector Rotation = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3Attribute(StageActor, Camera.CameraName, "xformOp:rotateXYZ", 0.0);
+    const FVector& Rotation = Rotations[0];
 
     if (Rotation == FVector::ZeroVector)
     {
@@ -487,6 +1215,32 @@ FReply FUSDCameraFrameRangesModule::OnDuplicateButtonClicked(FCameraInfo Camera,
     NewCameraActor->GetCineCameraComponent()->SetCurrentAperture(Camera.FStop);
     NewCameraActor->GetCineCameraComponent()->SetFilmback(FilmbackSettings);
 
+    return NewCameraActor;
+}
+
+
+/**
+ * @brief Handles the event when the duplicate button is clicked.
+ * Spawns a new CineCameraActor, sets its properties based on the found Usd camera information,
+ * and adds it to the specified level sequence if a path is provided.
+ * 
+ * @param Camera The camera information to duplicate.
+ * @param LevelSequencePath The path to the level sequence where the new camera should be added.
+ * @return FReply Indicates that the event has been handled.
+ */
+FReply FUSDCameraFrameRangesModule::OnDuplicateButtonClicked(FCameraInfo Camera, FString LevelSequencePath)
+{
+    UE_LOG(LogTemp, Log, TEXT("Duplicate button clicked for camera: %s"), *Camera.CameraName);
+
+    // Get the current editor world
+    UWorld* World =  GEditor->GetEditorWorldContext().World();
+
+    TObjectPtr<ACineCameraActor> NewCameraActor = SpawnDuplicateCamera(World, Camera);
+    if (!NewCameraActor)
+    {
+        return FReply::Handled();
+    }
+
     // Add the new camera to the level sequence if a path is provided
     if (!LevelSequencePath.IsEmpty())
     {
@@ -501,57 +1255,214 @@ FReply FUSDCameraFrameRangesModule::OnDuplicateButtonClicked(FCameraInfo Camera,
 }
 
 
+/**
+ * @brief Handles the event when the duplicate selected button is clicked.
+ * Duplicates every camera selected in the tab in one go, rather than paying the setup of a single duplicate per camera.
+ * The level sequence is loaded once, the animation of every camera is sampled in parallel, and the spawned
+ * cameras and their tracks are then added on the game thread inside one transaction, so a single undo removes
+ * them all. Cancelling keeps the cameras duplicated so far.
+ * 
+ * @param Cameras The cameras selected in the tab's camera list.
+ * @param LevelSequencePath The path to the level sequence where the new cameras should be added.
+ * @return FReply Indicates that the event has been handled.
+ */
+FReply FUSDCameraFrameRangesModule::OnDuplicateSelectedButtonClicked(TArray<FCameraInfo> Cameras, FString LevelSequencePath)
+{
+    if (Cameras.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No cameras selected to duplicate"));
+        return FReply::Handled();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Duplicating %d cameras"), Cameras.Num());
+
+    // Load the level sequence once for every camera
+    ULevelSequence* LevelSequence = nullptr;
+    if (!LevelSequencePath.IsEmpty())
+    {
+        LevelSequence = Cast<ULevelSequence>(StaticLoadObject(ULevelSequence::StaticClass(), nullptr, *LevelSequencePath));
+        if (LevelSequence == nullptr)
+        {
+            UE_LOG(LogTemp, Error, TEXT("No level sequence found at path %s"), *LevelSequencePath);
+            return FReply::Handled();
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Log, TEXT("Level sequence path empty, static cameras created"));
+    }
+
+    FScopedSlowTask SlowTask(Cameras.Num() + 1, LOCTEXT("DuplicatingCameras", "Duplicating USD cameras"));
+    SlowTask.MakeDialog(true);
+
+    // Every camera only reads its own attributes, so the samples are read on worker threads
+    TArray<FCameraBakeSamples> Samples;
+    SlowTask.EnterProgressFrame(1, LOCTEXT("SamplingCameras", "Sampling camera animation"));
+    if (LevelSequence)
+    {
+        const int32 TicksPerFrame = LevelSequence->MovieScene->GetTickResolution().AsDecimal() / LevelSequence->MovieScene->GetDisplayRate().AsDecimal();
+
+        Samples.SetNum(Cameras.Num());
+        ParallelFor(Cameras.Num(), [&Cameras, &Samples, TicksPerFrame](int32 Index)
+        {
+            SampleCameraAnimation(Cameras[Index], TicksPerFrame, Samples[Index]);
+        }, Cameras.Num() < USDCameraFrameRangesImpl::MinCamerasForParallelExtraction ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+    }
+
+    const FScopedTransaction Transaction(LOCTEXT("DuplicateCamerasTransaction", "Duplicate USD Cameras"));
+    if (LevelSequence)
+    {
+        LevelSequence->Modify();
+        LevelSequence->MovieScene->Modify();
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    UsdKeyReduction::FKeyReductionStats KeyStats;
+    int32 NumDuplicated = 0;
+    for (int32 Index = 0; Index < Cameras.Num(); ++Index)
+    {
+        if (SlowTask.ShouldCancel())
+        {
+            UE_LOG(LogTemp, Log, TEXT("Duplicating cameras cancelled after %d of %d"), NumDuplicated, Cameras.Num());
+            break;
+        }
+
+        const FCameraInfo& Camera = Cameras[Index];
+        SlowTask.EnterProgressFrame(1, FText::Format(LOCTEXT("DuplicatingCamera", "Duplicating {0}"), FText::FromString(Camera.CameraName)));
+
+        TObjectPtr<ACineCameraActor> NewCameraActor = SpawnDuplicateCamera(World, Camera);
+        if (!NewCameraActor)
+        {
+            continue;
+        }
+
+        if (LevelSequence)
+        {
+            BakeCameraToLevelSequence(LevelSequence, NewCameraActor, Camera, Samples[Index], KeyStats);
+        }
+        ++NumDuplicated;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Duplicated %d cameras with %d keys from %d samples"), NumDuplicated, KeyStats.KeysAfter, KeyStats.KeysBefore);
+
+    return FReply::Handled();
+}
+
+
 /**
  * @brief Handles the Material Swap button click event.
  * 
  * Swaps the materials of the Usd stage actor's generated components with 
  * the corresponding materials found in the Unreal project.
  * 
+ * Matches are found by name against the asset registry, so no material is loaded to find out it isn't
+ * needed. The matched materials are then loaded asynchronously, each once however many prims use it,
+ * and assigned when they have all arrived so the editor stays responsive with large material libraries.
+ * Materials bound to GeomSubsets go to the subset's material slot. Every assignment of a swap is made
+ * in one transaction, so it can be undone as a whole.
+ * 
  * @return A reply indicating whether the event was handled.
  */
 FReply FUSDCameraFrameRangesModule::OnMaterialSwapButtonClicked()
 {
-    UE::FUsdStage Stage = StageActor->GetUsdStage();
-    UE::FUsdPrim root = Stage.GetPseudoRoot();
-    TArray<FMaterialInfo> MaterialNames;
+	// Scan the Usd stage to find the materials bound within the Usd
+    TArray<FMaterialInfo> MaterialNames = ScanStage(EUsdStageScanContents::Materials).Materials;
+    if (MaterialNames.Num() == 0)
+    {
+        return FReply::Handled();
+    }
 
 	// Find the materials present in the project
-    TArray<UMaterial*>* FoundMaterials = GetAllMaterials();
+    const TMap<FString, FSoftObjectPath> FoundMaterials = GetAllMaterials();
+
+    // Pair each material slot of each prim with its Unreal material, keeping only the first match for a slot and reporting each missing name once
+    TMap<FString, TMap<int32, FSoftObjectPath>> MaterialsByPrimPath;
+    TSet<FSoftObjectPath> MaterialsToLoad;
+    TSet<FString> MissingMaterials;
+    for (FMaterialInfo& Mat : MaterialNames)
+    {
+        const FSoftObjectPath* MaterialPath = FoundMaterials.Find(Mat.MatName);
+        Mat.bMatchFound = MaterialPath != nullptr;
+        if (!MaterialPath)
+        {
+            MissingMaterials.Add(Mat.MatName);
+            continue;
+        }
+
+        TMap<int32, FSoftObjectPath>& SlotMaterials = MaterialsByPrimPath.FindOrAdd(Mat.PrimPath.GetString());
+        if (!SlotMaterials.Contains(Mat.MaterialSlot))
+        {
+            SlotMaterials.Add(Mat.MaterialSlot, *MaterialPath);
+            MaterialsToLoad.Add(*MaterialPath);
+        }
+    }
+
+    for (const FString& MissingMaterial : MissingMaterials)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Material: %s not found in project"), *MissingMaterial);
+    }
+
+    if (MaterialsToLoad.Num() == 0)
+    {
+        return FReply::Handled();
+    }
 
-	// Traverse the Usd stage to find materials within the Usd and
-    TraverseAndCollectMaterials(root, MaterialNames);
+    UE_LOG(LogTemp, Log, TEXT("Loading %d materials for %d prims"), MaterialsToLoad.Num(), MaterialsByPrimPath.Num());
 
-	// Iterate over all of the Usd materials and set those components to have the Unreal equivalent
-    if (MaterialNames.Num() > 0)
+    // A new swap replaces one that is still loading
+    if (MaterialSwapHandle.IsValid())
     {
-        for (FMaterialInfo Mat : MaterialNames)
+        MaterialSwapHandle->CancelHandle();
+    }
+
+    TWeakObjectPtr<AUsdStageActor> WeakStageActor = StageActor.Get();
+    MaterialSwapHandle = StreamableManager.RequestAsyncLoad(MaterialsToLoad.Array(), [WeakStageActor, MaterialsByPrimPath = MoveTemp(MaterialsByPrimPath)]()
+    {
+        AUsdStageActor* SwapStageActor = WeakStageActor.Get();
+        if (!SwapStageActor)
+        {
+            return;
+        }
+
+        const FScopedTransaction Transaction(LOCTEXT("SwapMaterialsTransaction", "Swap USD Materials"));
+
+        // Iterate over all of the matched prims and give their components the Unreal equivalents
+        for (const TPair<FString, TMap<int32, FSoftObjectPath>>& Match : MaterialsByPrimPath)
         {
-            UE::FUsdPrim CurrentPrim = Stage.GetPrimAtPath(Mat.PrimPath);
-            USceneComponent* GeneratedComponent = StageActor->GetGeneratedComponent(Mat.PrimPath.GetString());
-            
-            if (GeneratedComponent)
+            UMeshComponent* MeshComponent = Cast<UMeshComponent>(SwapStageActor->GetGeneratedComponent(Match.Key));
+            if (!MeshComponent)
+            {
+                continue;
+            }
+
+            const int32 NumMaterials = MeshComponent->GetNumMaterials();
+            bool bModified = false;
+            for (const TPair<int32, FSoftObjectPath>& SlotMaterial : Match.Value)
             {
-                UE_LOG(LogTemp, Log, TEXT("ObjName: %s Generated Component name: %s"), *Mat.ObjName, *GeneratedComponent->GetName());
+                UMaterialInterface* Material = Cast<UMaterialInterface>(SlotMaterial.Value.ResolveObject());
+                if (!Material)
+                {
+                    continue;
+                }
 
-                // Find the Unreal Material with the same name as the Usd material
-                FString MaterialName = Mat.MatName;
-                for (UMaterial* FoundMaterial : *FoundMaterials)
+                if (SlotMaterial.Key >= NumMaterials)
                 {
-                    if (MaterialName.Equals(FoundMaterial->GetName()))
-                    {
-                        UMeshComponent* MeshComponent = Cast<UMeshComponent>(GeneratedComponent);
+                    UE_LOG(LogTemp, Warning, TEXT("Component: %s has no material slot %d for material: %s"), *MeshComponent->GetName(), SlotMaterial.Key, *Material->GetName());
+                    continue;
+                }
 
-                        MeshComponent->SetMaterial(0, FoundMaterial);
-                        UE_LOG(LogTemp, Log, TEXT("Assigned material: %s to component: %s"), *MaterialName, *MeshComponent->GetName());
-                    }
-                    else
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("Material: %s not found in project"), *MaterialName);
-                    }
+                // Recorded once per component, before its first slot changes
+                if (!bModified)
+                {
+                    MeshComponent->Modify();
+                    bModified = true;
                 }
+                MeshComponent->SetMaterial(SlotMaterial.Key, Material);
+                UE_LOG(LogTemp, Log, TEXT("Assigned material: %s to slot %d of component: %s"), *Material->GetName(), SlotMaterial.Key, *MeshComponent->GetName());
             }
         }
-    }
+    });
+
     return FReply::Handled();
 }
 
@@ -611,15 +1522,21 @@ FReply FUSDCameraFrameRangesModule::OnAttributeExportButtonClicked(const FString
         int TicksPerFrame = LevelSequence->MovieScene->GetTickResolution().AsDecimal() / LevelSequence->MovieScene->GetDisplayRate().AsDecimal();
         FloatSection->SetRange(TRange<FFrameNumber>(FFrameNumber(StartFrame * TicksPerFrame), FFrameNumber(EndFrame * TicksPerFrame)));
 
-    	// Iterate over the time samples and add a key for the value at that frame
-        for (double Time : TimeSamples)
-        {
-            int KeyInt = static_cast<int>(Time);
-            FFrameNumber FrameNumber = FFrameNumber(KeyInt * TicksPerFrame);
-            float AttrVal = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(StageActor, InputPrim, InputAttr, Time);
+    	// Sample every authored value in one call, then key the channel with all of them at once
+        TArray<double> SampleTimes;
+        TArray<float> SampleValues = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttributeRange(StageActor, InputPrim, InputAttr, TimeSamples[0], TimeSamples.Last(), 1.0, true, SampleTimes);
 
-            FloatVal->AddConstantKey(FrameNumber, AttrVal);
+        TArray<FFrameNumber> KeyFrames;
+        KeyFrames.Reserve(SampleTimes.Num());
+        for (double SampleTime : SampleTimes)
+        {
+            KeyFrames.Add(FFrameNumber(static_cast<int>(SampleTime) * TicksPerFrame));
         }
+
+        UsdKeyReduction::FKeyReductionStats KeyStats;
+        FloatSection->Modify();
+        USDCameraFrameRangesImpl::SetKeys(*FloatVal, KeyFrames, SampleValues, KeyReductionTolerance, KeyStats);
+        UE_LOG(LogTemp, Log, TEXT("Exported %s.%s with %d keys from %d samples"), *InputPrim, *InputAttr, KeyStats.KeysAfter, KeyStats.KeysBefore);
     }
     else
     {
@@ -658,39 +1575,31 @@ FReply FUSDCameraFrameRangesModule::OnDisableManualFocusButtonClicked()
  * @brief Retrieves all UMaterial assets in the project.
  * 
  * Searches in the /Game/Materials directory in the project and collects all UMaterial assets.
+ * Only the asset registry is queried, so none of the materials are loaded.
  * 
- * Adapted from https://forums.unrealengine.com/t/plugin-get-all-materials-in-current-project/342793/10
- * 
- * @return A pointer to an array of UMaterial assets found in the project.
+ * @return The path of each material, keyed by its asset name.
  */
-TArray<UMaterial*>* FUSDCameraFrameRangesModule::GetAllMaterials()
+TMap<FString, FSoftObjectPath> FUSDCameraFrameRangesModule::GetAllMaterials()
 {
-	TArray<UMaterial*>* Assets = new TArray<UMaterial*>();
+	TMap<FString, FSoftObjectPath> Materials;
 
-	// Create a library to load all asset data, not filtered by a specific class
-	UObjectLibrary *lib = UObjectLibrary::CreateLibrary(UObject::StaticClass(), false, true);
-	UE_LOG(LogTemp, Warning, TEXT("Searching for assets in /Game/Materials..."));
+	FARFilter Filter;
+	Filter.PackagePaths.Add(TEXT("/Game/Materials"));
+	Filter.bRecursivePaths = true;
+	Filter.ClassPaths.Add(UMaterial::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
 
-	// Load asset data from the specified path
-	lib->LoadAssetDataFromPath(TEXT("/Game/Materials"));
+	TArray<FAssetData> AssetData;
+	IAssetRegistry::GetChecked().GetAssets(Filter, AssetData);
+	UE_LOG(LogTemp, Log, TEXT("Found %d materials in /Game/Materials"), AssetData.Num());
 
-	// Retrieve asset data list
-	TArray<FAssetData> assetData;
-	lib->GetAssetDataList(assetData);
-	UE_LOG(LogTemp, Warning, TEXT("Found %d assets"), assetData.Num());
-
-	// Iterate through all asset data and add to the Assets array
-	for (FAssetData asset : assetData)
+	Materials.Reserve(AssetData.Num());
+	for (const FAssetData& Asset : AssetData)
 	{
-		UMaterial* obj = Cast<UMaterial>(asset.GetAsset());
-		if (obj)
-		{
-			// UE_LOG(LogTemp, Warning, TEXT("Asset: %s, type: %s"), *obj->GetName(), *obj->GetClass()->GetName());
-			Assets->Add(obj);
-		}
+		Materials.Add(Asset.AssetName.ToString(), Asset.GetSoftObjectPath());
 	}
 
-	return Assets;
+	return Materials;
 }
 
 
@@ -715,12 +1624,33 @@ void FUSDCameraFrameRangesModule::AddCameraToLevelSequence(const FString& LevelS
         return;
     }
 
+    const int32 TicksPerFrame = LevelSequence->MovieScene->GetTickResolution().AsDecimal() / LevelSequence->MovieScene->GetDisplayRate().AsDecimal();
+
+    FCameraBakeSamples Samples;
+    SampleCameraAnimation(Camera, TicksPerFrame, Samples);
+
+    UsdKeyReduction::FKeyReductionStats KeyStats;
+    BakeCameraToLevelSequence(LevelSequence, CameraActor, Camera, Samples, KeyStats);
+}
+
+
+/**
+ * @brief Adds a CineCameraActor to a loaded Level Sequence and keys its transform from samples already read.
+ * 
+ * @param LevelSequence The Level Sequence to add the camera to.
+ * @param CameraActor Pointer to the CineCameraActor to be added to the Level Sequence.
+ * @param Camera Information about the camera, for its frame range and name.
+ * @param Samples The camera's transform at each of its time samples.
+ * @param Stats Accumulates the key counts before and after reduction.
+ */
+void FUSDCameraFrameRangesModule::BakeCameraToLevelSequence(ULevelSequence* LevelSequence, const TObjectPtr<ACineCameraActor>& CameraActor, const FCameraInfo& Camera, const FCameraBakeSamples& Samples, UsdKeyReduction::FKeyReductionStats& Stats)
+{
     // Create a possessable for the camera actor in the Level Sequence
     FGuid Guid = Cast<UMovieSceneSequence>(LevelSequence)->CreatePossessable(CameraActor);
 
     if (Guid.IsValid())
     {
-        UE_LOG(LogTemp, Log, TEXT("Camera actor added to %s with Guid %s"), *LevelSequencePath, *Guid.ToString());
+        UE_LOG(LogTemp, Log, TEXT("Camera actor added to %s with Guid %s"), *LevelSequence->GetPathName(), *Guid.ToString());
     }
     else
     {
@@ -744,40 +1674,83 @@ void FUSDCameraFrameRangesModule::AddCameraToLevelSequence(const FString& LevelS
     FMovieSceneDoubleChannel* RotateY = TransformSection->GetChannelProxy().GetChannel<FMovieSceneDoubleChannel>(4);
     FMovieSceneDoubleChannel* RotateZ = TransformSection->GetChannelProxy().GetChannel<FMovieSceneDoubleChannel>(5);
 
-    UE::FVtValue UsdValue;
-
-    // Add translation keyframes
-    for (double Time : Camera.TransTimeSamples)
-    {		
-        int KeyInt = static_cast<int>(Time);
-        FFrameNumber FrameNumber = FFrameNumber(KeyInt * TicksPerFrame);
-    	FVector Translation = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3Attribute(StageActor, Camera.CameraName, "xformOp:translate", Time);
-    	if (Translation.IsZero())
-    	{
-    		UE_LOG(LogTemp, Warning, TEXT("Zero vector found when finding translate attribute"))
-    	}
-    	TranslateX->AddConstantKey(FrameNumber, Translation[0]);
-    	TranslateY->AddConstantKey(FrameNumber, Translation[2]);
-    	TranslateZ->AddConstantKey(FrameNumber, Translation[1]);
+    // Modify the section once, then fill each channel with all of its keys at once
+    UsdKeyReduction::FKeyReductionStats KeyStats;
+    TransformSection->Modify();
+    USDCameraFrameRangesImpl::SetKeys(*TranslateX, Samples.TranslateFrames, Samples.TranslateValues[0], KeyReductionTolerance, KeyStats);
+    USDCameraFrameRangesImpl::SetKeys(*TranslateY, Samples.TranslateFrames, Samples.TranslateValues[1], KeyReductionTolerance, KeyStats);
+    USDCameraFrameRangesImpl::SetKeys(*TranslateZ, Samples.TranslateFrames, Samples.TranslateValues[2], KeyReductionTolerance, KeyStats);
+    USDCameraFrameRangesImpl::SetKeys(*RotateX, Samples.RotateFrames, Samples.RotateValues[0], KeyReductionTolerance, KeyStats);
+    USDCameraFrameRangesImpl::SetKeys(*RotateY, Samples.RotateFrames, Samples.RotateValues[1], KeyReductionTolerance, KeyStats);
+    USDCameraFrameRangesImpl::SetKeys(*RotateZ, Samples.RotateFrames, Samples.RotateValues[2], KeyReductionTolerance, KeyStats);
+    UE_LOG(LogTemp, Log, TEXT("Baked %s with %d keys from %d samples"), *Camera.CameraName, KeyStats.KeysAfter, KeyStats.KeysBefore);
+
+    Stats.KeysBefore += KeyStats.KeysBefore;
+    Stats.KeysAfter += KeyStats.KeysAfter;
+
+    // Add the transform section to the track
+    TransformTrack->AddSection(*TransformSection);
+}
+
+
+/**
+ * @brief Reads a camera's translation and rotation at each of their time samples.
+ * 
+ * The values are read directly off the attributes found by the stage scan rather than through the
+ * attribute getters, which resolve the stage actor and its caches, so cameras can be sampled in parallel.
+ * Translations are converted to Unreal's Z up and rotations to the order of the transform section's channels.
+ * 
+ * @param Camera The camera whose translation and rotation are read.
+ * @param TicksPerFrame The ticks per display frame of the level sequence the samples are keyed into.
+ * @param OutSamples Receives the frames and channel values.
+ */
+void FUSDCameraFrameRangesModule::SampleCameraAnimation(const FCameraInfo& Camera, int32 TicksPerFrame, FCameraBakeSamples& OutSamples)
+{
+    using namespace USDCameraFrameRangesImpl;
+
+    TArray<FVector> Translations;
+    GetVec3TimeSamples(Camera.Translation, Camera.TransTimeSamples, Translations);
+
+    OutSamples.TranslateFrames.Reserve(Translations.Num());
+    for (TArray<double>& Values : OutSamples.TranslateValues)
+    {
+        Values.Reserve(Translations.Num());
     }
 
-    // Add rotation keyframes
-    for (double Time : Camera.RotTimeSamples)
+    for (int32 SampleIndex = 0; SampleIndex < Translations.Num(); ++SampleIndex)
     {
-        int KeyInt = static_cast<int>(Time);
-        FFrameNumber FrameNumber = FFrameNumber(KeyInt * TicksPerFrame);
-    	FVector Rotation = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3Attribute(StageActor, Camera.CameraName, "xformOp:rotateXYZ", Time);
-    	if (Rotation.IsZero())
-    	{
-    		UE_LOG(LogTemp, Warning, TEXT("Zero vector found when finding rotation attribute"))
-    	}
-    	RotateX->AddConstantKey(FrameNumber, Rotation[2]);
-    	RotateY->AddConstantKey(FrameNumber, Rotation[0]);
-    	RotateZ->AddConstantKey(FrameNumber, (Rotation[1] * -1) - 90);
+        const FVector& Translation = Translations[SampleIndex];
+        if (Translation.IsZero())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Zero vector found when finding translate attribute"))
+        }
+        OutSamples.TranslateFrames.Add(FFrameNumber(static_cast<int>(Camera.TransTimeSamples[SampleIndex]) * TicksPerFrame));
+        OutSamples.TranslateValues[0].Add(Translation[0]);
+        OutSamples.TranslateValues[1].Add(Translation[2]);
+        OutSamples.TranslateValues[2].Add(Translation[1]);
     }
 
-    // Add the transform section to the track
-    TransformTrack->AddSection(*TransformSection);
+    TArray<FVector> Rotations;
+    GetVec3TimeSamples(Camera.Rotation, Camera.RotTimeSamples, Rotations);
+
+    OutSamples.RotateFrames.Reserve(Rotations.Num());
+    for (TArray<double>& Values : OutSamples.RotateValues)
+    {
+        Values.Reserve(Rotations.Num());
+    }
+
+    for (int32 SampleIndex = 0; SampleIndex < Rotations.Num(); ++SampleIndex)
+    {
+        const FVector& Rotation = Rotations[SampleIndex];
+        if (Rotation.IsZero())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Zero vector found when finding rotation attribute"))
+        }
+        OutSamples.RotateFrames.Add(FFrameNumber(static_cast<int>(Camera.RotTimeSamples[SampleIndex]) * TicksPerFrame));
+        OutSamples.RotateValues[0].Add(Rotation[2]);
+        OutSamples.RotateValues[1].Add(Rotation[0]);
+        OutSamples.RotateValues[2].Add((Rotation[1] * -1) - 90);
+    }
 }
 
 
@@ -796,301 +1769,210 @@ void FUSDCameraFrameRangesModule::DisableManualFocus(TObjectPtr<ACineCameraActor
 /**
  * Find and add the frame ranges from cameraMain's camera number attribute to the FCameraInfo structs.
  *
- * @param Cameras An array of FCameraInfo objects representing the cameras found in the Usd file.
+ * The stepped cameraNumber track is run-length encoded in one pass over its time samples into an ordered
+ * list of cuts. A cut starts at the first sample of a run of equal values and holds until the frame before
+ * the next cut, the last cut ending at its last sample, so tracks keyed every frame and tracks keyed only at
+ * the start and end of each cut give the same ranges. Cameras are looked up by number from a map built once,
+ * and a camera that cameraMain cuts to more than once keeps every one of its ranges.
+ *
+ * @param Cameras The camera records of the cameras found in the Usd file.
+ * @param CameraNumberAttr The cameraNumber attribute of the cameraMain prim, as found by ScanStage.
+ * @return The cuts of cameraMain in frame order.
  */
-void FUSDCameraFrameRangesModule::FindCameraMainFrameRanges(TArray<FCameraInfo>& Cameras)
+TArray<FCameraCut> FUSDCameraFrameRangesModule::FindCameraMainFrameRanges(const TArray<TSharedPtr<FCameraInfo>>& Cameras, const UE::FUsdAttribute& CameraNumberAttr)
 {
-    // Get the "cameraNumber" attribute from the cameraMain prim
-    UE::FUsdAttribute CameraNumberAttr = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeInternal(StageActor, "cameraMain", "cameraNumber");
+    TArray<FCameraCut> Cuts;
 
-    TArray<double> CameraNumberTimeSamples;
+    // Clear the previous ranges, as this also runs again when cameraMain is edited
+    for (const TSharedPtr<FCameraInfo>& Camera : Cameras)
+    {
+        Camera->CameraMainRanges.Reset();
+        Camera->inCameraMain = false;
+    }
 
     // Check if the camera number attribute was successfully retrieved
     if (!CameraNumberAttr)
     {
         UE_LOG(LogTemp, Warning, TEXT("No cameraMain or camera number attribute found"));
-        return;
+        return Cuts;
     }
 
-    // Attempt to get the time samples for the camera number attribute
-    if (bool bSuccess = CameraNumberAttr.GetTimeSamples(CameraNumberTimeSamples))
-    {
-        int currentVal = 0;    // Variable to store the current camera number
-        int32 prevTime = 0;    // Variable to store the previous time sample
-
-        // Iterate through each time sample
-        for (double Time : CameraNumberTimeSamples)
-        {
-            int prevVal = currentVal;    // Store the previous camera number
-        	
-            // Get the camera number at the current time sample
-            currentVal = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedIntAttribute(StageActor, "cameraMain", "cameraNumber", Time);
-
-            // Check if the camera number has not changed since the last sample
-            if (currentVal == prevVal)
-            {
-                // Construct the current camera name based on the camera number
-                FString CurrentName = TEXT("camera") + FString::FromInt(currentVal);
-
-                // Update the frame ranges for the camera with the matching name
-                for (FCameraInfo& Camera : Cameras)
-                {
-                    if (Camera.CameraName == CurrentName)
-                    {
-                        Camera.CameraMainStartFrame = prevTime;
-                        Camera.CameraMainEndFrame = static_cast<int32>(Time);
-                        Camera.inCameraMain = true;
-                        UE_LOG(LogTemp, Log, TEXT("Frame range found for %s with times %d and %d"), *Camera.CameraName, Camera.CameraMainStartFrame, Camera.CameraMainEndFrame);
-
-                        break;  // Exit the loop once the camera is found and updated
-                    }
-                }
-            }
-
-            // Update the previous time sample
-            prevTime = static_cast<int32>(Time);
-        }
-    }
-    else
+    TArray<double> CameraNumberTimeSamples;
+    if (!CameraNumberAttr.GetTimeSamples(CameraNumberTimeSamples))
     {
         // Log a warning if there was an issue getting the time samples
         UE_LOG(LogTemp, Warning, TEXT("Issue finding time samples for camera number"));
-        return;
+        return Cuts;
     }
-}
-
-
-/**
- * @brief Retrieves camera information from the Usd stage associated with StageActor.
- *
- * Runs through all of the cameras found within the Usd file to find the
- * name, path, Translation and Rotation attribute and timesamples,
- * start and end frame, focal length, focus distance, FStop,
- * and horizontal and vertical aperture
- * 
- * @return TArray<FCameraInfo> An array of FCameraInfo structures containing details about each camera found in the USD stage.
- */
-TArray<FCameraInfo> FUSDCameraFrameRangesModule::GetCamerasFromUSDStage()
-{
-    TArray<FCameraInfo> Cameras;
 
-    // Check if StageActor is valid
-    if (!StageActor)
+    // Map each camera number to the camera named after it, i.e. 3 to camera3
+    TMap<int32, int32> CameraIndexByNumber;
+    CameraIndexByNumber.Reserve(Cameras.Num());
+    for (int32 CameraIndex = 0; CameraIndex < Cameras.Num(); ++CameraIndex)
     {
-        UE_LOG(LogTemp, Warning, TEXT("StageActor is null."));
-        return Cameras;
+        const FString& CameraName = Cameras[CameraIndex]->CameraName;
+        if (CameraName.StartsWith(TEXT("camera"), ESearchCase::CaseSensitive))
+        {
+            const int32 CameraNumber = FCString::Atoi(*CameraName + 6);
+            if (CameraName == TEXT("camera") + FString::FromInt(CameraNumber))
+            {
+                CameraIndexByNumber.Add(CameraNumber, CameraIndex);
+            }
+        }
     }
 
-    // Get the Usd stage from StageActor
-    UE::FUsdStage StageBase = StageActor->GetUsdStage();
-    UE::FUsdPrim root = StageBase.GetPseudoRoot();
-
-    // Array to hold the paths of all cameras
-    TArray<UE::FSdfPath> CameraPaths;
-    TraverseAndCollectCameras(root, CameraPaths);
-
-    // Check if any cameras were found
-    if (CameraPaths.Num() == 0)
+    // Get the camera number at each time sample, directly off the attribute found by the scan
+    const pxr::UsdAttribute& UsdCameraNumberAttr = static_cast<const pxr::UsdAttribute&>(CameraNumberAttr);
+    for (const double Time : CameraNumberTimeSamples)
     {
-        UE_LOG(LogTemp, Warning, TEXT("No cameras found in the USD Stage."));
-        return Cameras;
-    }
+        int CameraNumber = 0;
+        UsdCameraNumberAttr.Get(&CameraNumber, pxr::UsdTimeCode(Time));
 
-    // Iterate through each camera path found
-    for (UE::FSdfPath path : CameraPaths)
-    {
-        UE::FUsdPrim CurrentPrim = StageBase.GetPrimAtPath(path);
-        if (!CurrentPrim)
+        const int32 Frame = static_cast<int32>(Time);
+        if (Cuts.Num() > 0 && Cuts.Last().CameraNumber == CameraNumber)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Failed to get Prim at path: %s"), *path.GetString());
+            Cuts.Last().EndFrame = Frame;
             continue;
         }
 
-        // Create a new FCameraInfo structure to hold the camera's details
-        FCameraInfo CameraInfo;
-        CameraInfo.CameraName = CurrentPrim.GetName().ToString();
-        
-        // Get translation and rotation attributes for the camera
-        CameraInfo.Translation = CurrentPrim.GetAttribute(TEXT("xformOp:translate"));
-        CameraInfo.Rotation = CurrentPrim.GetAttribute(TEXT("xformOp:rotateXYZ"));
+        // A change of camera closes the previous cut on the frame before this one
+        if (Cuts.Num() > 0)
+        {
+            Cuts.Last().EndFrame = FMath::Max(Cuts.Last().StartFrame, Frame - 1);
+        }
 
-        if (CameraInfo.Rotation && CameraInfo.Translation)
+        FCameraCut& Cut = Cuts.AddDefaulted_GetRef();
+        Cut.CameraNumber = CameraNumber;
+        Cut.StartFrame = Frame;
+        Cut.EndFrame = Frame;
+        if (const int32* CameraIndex = CameraIndexByNumber.Find(CameraNumber))
         {
-            // Get time samples for the translation and rotation attributes
-            CameraInfo.Rotation.GetTimeSamples(CameraInfo.RotTimeSamples);
-            CameraInfo.Translation.GetTimeSamples(CameraInfo.TransTimeSamples);
-            
-            // Determine the start and end frames based on time samples
-        	if (CameraInfo.RotTimeSamples.Num() > 1 || CameraInfo.TransTimeSamples.Num() > 1)
-        	{
-        		if (CameraInfo.RotTimeSamples.Num() > CameraInfo.TransTimeSamples.Num())
-        		{
-        			// Ensure RotTimeSamples has at least 2 elements
-        			if (CameraInfo.RotTimeSamples.Num() > 1)
-        			{
-        				if (CameraInfo.RotTimeSamples[1] == 2.0)
-        					CameraInfo.StartFrame = CameraInfo.RotTimeSamples[0];
-        				else
-        					CameraInfo.StartFrame = CameraInfo.RotTimeSamples[1];
-        			}
-        			else
-        			{
-        				// Handle case where there is only one element
-        				CameraInfo.StartFrame = CameraInfo.RotTimeSamples[0];
-        			}
-
-        			CameraInfo.EndFrame = CameraInfo.RotTimeSamples.Last();
-        		}
-        		else
-        		{
-        			// Ensure TransTimeSamples has at least 2 elements
-        			if (CameraInfo.TransTimeSamples.Num() > 1)
-        			{
-        				if (CameraInfo.TransTimeSamples[1] == 2.0)
-        					CameraInfo.StartFrame = CameraInfo.TransTimeSamples[0];
-        				else
-        					CameraInfo.StartFrame = CameraInfo.TransTimeSamples[1];
-        			}
-        			else
-        			{
-        				// Handle case where there is only one element
-        				CameraInfo.StartFrame = CameraInfo.TransTimeSamples[0];
-        			}
-
-        			CameraInfo.EndFrame = CameraInfo.TransTimeSamples.Last();
-        		}
-        	}
-        	else
-        	{
-        		CameraInfo.StartFrame = 1;
-        		CameraInfo.EndFrame = 1;
-        	}
-
-
-            // Retrieve additional camera attributes
-            CameraInfo.FocalLength = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(StageActor, CameraInfo.CameraName, FString(TEXT("focalLength")), 1.0);
-            CameraInfo.FocusDistance = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(StageActor, CameraInfo.CameraName, FString(TEXT("focusDistance")), 1.0);
-            CameraInfo.FStop = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(StageActor, CameraInfo.CameraName, FString(TEXT("fStop")), 1.0);
-            CameraInfo.HorizontalAperture = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(StageActor, CameraInfo.CameraName, FString(TEXT("horizontalAperture")), 1.0);
-            CameraInfo.VerticalAperture = UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(StageActor, CameraInfo.CameraName, FString(TEXT("verticalAperture")), 1.0);
-
-            // Add the camera info to the array
-            Cameras.Add(CameraInfo);
+            Cut.CameraIndex = *CameraIndex;
         }
-        else
+    }
+
+    for (const FCameraCut& Cut : Cuts)
+    {
+        if (Cut.CameraIndex == INDEX_NONE)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Failed to get necessary attributes for camera: %s"), *CameraInfo.CameraName);
+            continue;
         }
+
+        FCameraInfo& Camera = *Cameras[Cut.CameraIndex];
+        Camera.CameraMainRanges.Emplace(Cut.StartFrame, Cut.EndFrame);
+        Camera.inCameraMain = true;
+        UE_LOG(LogTemp, Log, TEXT("Frame range found for %s with times %d and %d"), *Camera.CameraName, Cut.StartFrame, Cut.EndFrame);
     }
 
-    return Cameras;
+    return Cuts;
 }
 
 
 /**
- * @brief Recursively traverses the Usd stage to collect camera prim paths.
+ * @brief Walks the Usd stage associated with StageActor once, collecting everything the tool needs.
+ *
+ * Cameras, the cameraMain prim and material bindings are all read off the prim in hand during a single
+ * pxr::UsdPrimRange traversal, rather than walking the stage once per kind of prim and then searching
+ * for each camera again by name to read its attributes. The cameras' time samples, frame ranges and
+ * intrinsics are then extracted in parallel, as shots can hold dozens of camera variants.
  * 
- * @param CurrentPrim The current Usd prim being examined.
- * @param OutCameraPaths Array to store the paths of found camera prims.
+ * @param Contents What to collect, the cameraMain prim is always found.
+ * @return FUsdStageScan The cameras, material bindings and cameraMain found on the stage.
  */
-void FUSDCameraFrameRangesModule::TraverseAndCollectCameras(const UE::FUsdPrim& CurrentPrim,
-	TArray<UE::FSdfPath>& OutCameraPaths)
+FUsdStageScan FUSDCameraFrameRangesModule::ScanStage(EUsdStageScanContents Contents) const
 {
+	using namespace USDCameraFrameRangesImpl;
 
-	// Ensure there is a valid prim
-	if (!CurrentPrim.IsValid())
+	FUsdStageScan Scan;
+
+	if (!StageActor)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No valid prim found on the UsdStageActor"))
-		return;
+		UE_LOG(LogTemp, Warning, TEXT("StageActor is null."));
+		return Scan;
 	}
-	
-    // Check if the current prim is of type "Camera"
-	if (CurrentPrim.IsA(FName(TEXT("Camera"))))
+
+	pxr::UsdStageRefPtr Stage{ StageActor->GetUsdStage() };
+	if (!Stage)
 	{
-		// Add prim path to array if it is
-		UE::FSdfPath path = CurrentPrim.GetPrimPath();
-		OutCameraPaths.Add(path);
+		UE_LOG(LogTemp, Warning, TEXT("No USD Stage opened on the StageActor."));
+		return Scan;
 	}
 
-    // Recursively traverse child prims
-	for (UE::FUsdPrim& Child : CurrentPrim.GetChildren())
+	const bool bCollectCameras = EnumHasAnyFlags(Contents, EUsdStageScanContents::Cameras);
+	const bool bCollectMaterials = EnumHasAnyFlags(Contents, EUsdStageScanContents::Materials);
+
+	TArray<pxr::UsdPrim> CameraPrims;
+	TArray<pxr::UsdPrim> Gprims;
+	for (const pxr::UsdPrim& Prim : pxr::UsdPrimRange::Stage(Stage))
 	{
-		TraverseAndCollectCameras(Child, OutCameraPaths);
+		if (bCollectCameras && Prim.IsA<pxr::UsdGeomCamera>())
+		{
+			CameraPrims.Add(Prim);
+		}
+
+		// The getters address cameraMain by name, which resolves to the first match in traversal order
+		if (!Scan.CameraMainNumber)
+		{
+			Scan.CameraMainNumber = GetCameraMainNumber(Prim);
+		}
+
+		if (bCollectMaterials && Prim.IsA<pxr::UsdGeomGprim>())
+		{
+			Gprims.Add(Prim);
+		}
 	}
-}
 
-/**
- * @brief Recursively traverses the Usd stage to collect material information.
- *
- * This is specifically looking for materials under 'Shader' in the Usd.
- * Out of Maya, this is after the shading group which appears as mtl. This may need
- * adjustments for different workflows.
- * 
- * @param CurrentPrim The current Usd prim being examined.
- * @param MaterialNames Array to store material information found in the stage.
- */
-void FUSDCameraFrameRangesModule::TraverseAndCollectMaterials(const UE::FUsdPrim& CurrentPrim, TArray<FMaterialInfo>& MaterialNames)
-{
-    // Get the Usd stage from StageActor
-	UE::FUsdStage Stage = StageActor->GetUsdStage();
-	if (!CurrentPrim)
+	if (bCollectMaterials)
 	{
-		return;
+		CollectMaterialBindings(Gprims, Scan.Materials);
 	}
 
-    // Define the relationship name for material bindings
-	const TCHAR* RelationshipName = TEXT("material:binding");
+	// Each camera's extraction only reads from the stage, so it runs on workers. Every camera writes to
+	// its own slot and the slots are compacted afterwards, keeping the traversal order whatever the scheduling
+	TArray<FCameraInfo> ExtractedCameras;
+	ExtractedCameras.SetNum(CameraPrims.Num());
+	TArray<bool> CameraValid;
+	CameraValid.SetNumZeroed(CameraPrims.Num());
 
-    // Check if the current prim has a material binding relationship
-	if (UE::FUsdRelationship MaterialBindingRel = CurrentPrim.GetRelationship(RelationshipName))
+	ParallelFor(CameraPrims.Num(), [&CameraPrims, &ExtractedCameras, &CameraValid](int32 Index)
 	{
-		TArray<UE::FSdfPath> TargetPaths;
-        // Get the target paths for the material binding relationship
-		bool bTargets = MaterialBindingRel.GetTargets(TargetPaths);
-		if (bTargets)
-		{
-			for (const UE::FSdfPath& Path : TargetPaths)
-			{
-				// UE_LOG(LogTemp, Log, TEXT("Current prim: %s Target path: %s"), *CurrentPrim.GetName().ToString(), *Path.GetString());
+		CameraValid[Index] = ExtractCameraInfo(CameraPrims[Index], ExtractedCameras[Index]);
+	}, CameraPrims.Num() >= MinCamerasForParallelExtraction ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
 
-                // Get the prim at the target path
-				if (UE::FUsdPrim MaterialPrim = Stage.GetPrimAtPath(Path))
-				{
-					FString MaterialName = MaterialPrim.GetName().ToString();
-					// UE_LOG(LogTemp, Log, TEXT("Material found: %s"), *MaterialName);
-
-                    // Iterate through child prims of the material prim
-					for (UE::FUsdPrim ChildPrim : MaterialPrim.GetChildren())
-					{
-                        // Check if the child prim is a shader
-						if (ChildPrim.IsA("Shader"))
-						{
-							FString ShaderName = ChildPrim.GetName().ToString();
-							// UE_LOG(LogTemp, Log, TEXT("Shader found: %s"), *ShaderName);
-
-                            // Create and populate a FMaterialInfo structure
-							FMaterialInfo MaterialInfo;
-							MaterialInfo.ObjName = CurrentPrim.GetName().ToString();
-							MaterialInfo.MatName = ShaderName;
-							MaterialInfo.PrimPath = CurrentPrim.GetPrimPath();
-
-							// UE_LOG(LogTemp, Log, TEXT("Adding material info, ObjName: %s MatName: %s PrimPath: %s"), *MaterialInfo.ObjName,  *MaterialInfo.MatName, *MaterialInfo.PrimPath.GetString());
-
-                            // Add the material info to the array
-							MaterialNames.Add(MaterialInfo);
-						}
-					}
-				}
-			}
+	Scan.Cameras.Reserve(ExtractedCameras.Num());
+	for (int32 Index = 0; Index < ExtractedCameras.Num(); ++Index)
+	{
+		if (CameraValid[Index])
+		{
+			Scan.Cameras.Add(MoveTemp(ExtractedCameras[Index]));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to get necessary attributes for camera: %s"), *ExtractedCameras[Index].CameraName);
 		}
 	}
 
-    // Recursively traverse child prims for additional materials
-	for (pxr::UsdPrim ChildPrim : CurrentPrim.GetChildren())
+	if (bCollectCameras && Scan.Cameras.Num() == 0)
 	{
-		UE::FUsdPrim UEChildPrim(ChildPrim);
-		TraverseAndCollectMaterials(UEChildPrim, MaterialNames);
+		UE_LOG(LogTemp, Warning, TEXT("No cameras found in the USD Stage."));
 	}
+
+	return Scan;
+}
+
+/**
+ * @brief Retrieves camera information from the Usd stage associated with StageActor.
+ *
+ * Runs through all of the cameras found within the Usd file to find the
+ * name, path, Translation and Rotation attribute and timesamples,
+ * start and end frame, focal length, focus distance, FStop,
+ * and horizontal and vertical aperture
+ * 
+ * @return TArray<FCameraInfo> An array of FCameraInfo structures containing details about each camera found in the USD stage.
+ */
+TArray<FCameraInfo> FUSDCameraFrameRangesModule::GetCamerasFromUSDStage()
+{
+	return ScanStage(EUsdStageScanContents::Cameras).Cameras;
 }
 
 
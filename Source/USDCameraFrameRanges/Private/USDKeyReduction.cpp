@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "USDKeyReduction.h"
+
+void UsdKeyReduction::ReduceKeys(TArrayView<const double> Times, TArrayView<const double> Values, double Tolerance, TArray<FReducedKey>& OutKeys)
+{
+    check(Times.Num() == Values.Num());
+
+    const int32 NumSamples = Times.Num();
+    OutKeys.Reset();
+    if (NumSamples == 0)
+    {
+        return;
+    }
+
+    int32 Anchor = 0;
+    while (Anchor < NumSamples - 1)
+    {
+        const double AnchorTime = Times[Anchor];
+        const double AnchorValue = Values[Anchor];
+
+        // Every sample between the anchor and a candidate end key must lie within the tolerance of the
+        // held anchor value, or of the line to the end key. The latter holds when the line's slope is in
+        // the range allowed by each of those samples, so the range is narrowed as samples are passed
+        bool bCanHold = true;
+        double MinSlope = -UE_DOUBLE_BIG_NUMBER;
+        double MaxSlope = UE_DOUBLE_BIG_NUMBER;
+
+        int32 EndKey = Anchor + 1;
+        ERichCurveInterpMode InterpMode = RCIM_Constant;
+
+        for (int32 Candidate = Anchor + 1; Candidate < NumSamples; ++Candidate)
+        {
+            // The previous candidate becomes a dropped sample between the anchor and this one
+            if (Candidate > Anchor + 1)
+            {
+                const int32 Dropped = Candidate - 1;
+                const double DeltaTime = Times[Dropped] - AnchorTime;
+                bCanHold &= FMath::Abs(Values[Dropped] - AnchorValue) <= Tolerance;
+                MinSlope = FMath::Max(MinSlope, (Values[Dropped] - Tolerance - AnchorValue) / DeltaTime);
+                MaxSlope = FMath::Min(MaxSlope, (Values[Dropped] + Tolerance - AnchorValue) / DeltaTime);
+            }
+
+            const bool bCanLerp = MinSlope <= MaxSlope;
+            if (!bCanHold && !bCanLerp)
+            {
+                break;
+            }
+
+            // Held keys are preferred, as they evaluate exactly to the anchor value
+            if (bCanHold)
+            {
+                EndKey = Candidate;
+                InterpMode = RCIM_Constant;
+                continue;
+            }
+
+            // Stop at the first candidate off every allowed line rather than looking further ahead, so the
+            // next key starts from the previous candidate and no sample is scanned more than twice
+            const double Slope = (Values[Candidate] - AnchorValue) / (Times[Candidate] - AnchorTime);
+            if (Slope < MinSlope || Slope > MaxSlope)
+            {
+                break;
+            }
+            EndKey = Candidate;
+            InterpMode = RCIM_Linear;
+        }
+
+        OutKeys.Add(FReducedKey{ Anchor, InterpMode });
+        Anchor = EndKey;
+    }
+
+    OutKeys.Add(FReducedKey{ NumSamples - 1, RCIM_Constant });
+}
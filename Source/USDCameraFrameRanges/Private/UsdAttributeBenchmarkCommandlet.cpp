@@ -0,0 +1,504 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeBenchmarkCommandlet.h"
+
+#include "USDCameraFrameRanges.h"
+#include "UsdAttributeFunctionLibraryBPLibrary.h"
+#include "UsdAttributeStageCache.h"
+#include "USDStageActor.h"
+#include "UnrealUSDWrapper.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/quatf.h"
+#include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec4f.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usd/stageCacheContext.h"
+#include "pxr/usd/usdGeom/camera.h"
+#include "pxr/usd/usdGeom/scope.h"
+#include "pxr/usd/usdGeom/xform.h"
+#include "pxr/usd/usdUtils/stageCache.h"
+#include "USDIncludesEnd.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogUsdAttributeBenchmark, Log, All);
+
+namespace UsdAttributeBenchmarkImpl
+{
+    /** Each shot holds one camera and this many scopes less one. */
+    constexpr int32 PrimsPerShot = 100;
+    constexpr int32 ArrayLength = 16;
+
+    /** One getter to time, along with the attribute it reads on the synthetic stage. */
+    struct FGetterCase
+    {
+        const TCHAR* Name;
+        const TCHAR* AttrName;
+        bool bAnimated;
+        /** How many values one call reads, so iterations can be scaled down for range and batch reads. */
+        int32 ValuesPerCall;
+        TFunction<void(AUsdStageActor*, const FString&, const FString&, double)> Call;
+    };
+
+    #define USD_BENCHMARK_GETTER(Getter, AttrName) \
+        { TEXT(#Getter), TEXT(AttrName), false, 1, [](AUsdStageActor* StageActor, const FString& PrimName, const FString& Attr, double) \
+            { UUsdAttributeFunctionLibraryBPLibrary::Getter(StageActor, PrimName, Attr); } }
+
+    #define USD_BENCHMARK_ANIMATED_GETTER(Getter, AttrName) \
+        { TEXT(#Getter), TEXT(AttrName), true, 1, [](AUsdStageActor* StageActor, const FString& PrimName, const FString& Attr, double Time) \
+            { UUsdAttributeFunctionLibraryBPLibrary::Getter(StageActor, PrimName, Attr, Time); } }
+
+    #define USD_BENCHMARK_RANGE_GETTER(Getter, AttrName) \
+        { TEXT(#Getter), TEXT(AttrName), true, Frames, [Frames](AUsdStageActor* StageActor, const FString& PrimName, const FString& Attr, double) \
+            { TArray<double> Times; UUsdAttributeFunctionLibraryBPLibrary::Getter(StageActor, PrimName, Attr, 0.0, Frames - 1.0, 1.0, true, Times); } }
+
+    /** The scalar attributes read together by the batch getter. */
+    const TPair<const TCHAR*, EUsdAttributeValueType> BatchAttributes[] =
+    {
+        { TEXT("customFloat"), EUsdAttributeValueType::Float },
+        { TEXT("customDouble"), EUsdAttributeValueType::Double },
+        { TEXT("customInt"), EUsdAttributeValueType::Int },
+        { TEXT("customVec3"), EUsdAttributeValueType::Vec3 },
+        { TEXT("customBool"), EUsdAttributeValueType::Bool },
+        { TEXT("customVec2"), EUsdAttributeValueType::Vec2 },
+        { TEXT("customVec4"), EUsdAttributeValueType::Vec4 },
+        { TEXT("customQuat"), EUsdAttributeValueType::Quat },
+        { TEXT("customMatrix"), EUsdAttributeValueType::Matrix },
+        { TEXT("customString"), EUsdAttributeValueType::String },
+        { TEXT("customColour"), EUsdAttributeValueType::Color }
+    };
+
+    void ReadBatch(AUsdStageActor* StageActor, const FString& PrimName, bool bAnimated, double Time)
+    {
+        TArray<FUsdAttributeRequest> Requests;
+        Requests.Reserve(UE_ARRAY_COUNT(BatchAttributes));
+        for (const TPair<const TCHAR*, EUsdAttributeValueType>& Attribute : BatchAttributes)
+        {
+            FUsdAttributeRequest& Request = Requests.AddDefaulted_GetRef();
+            Request.PrimName = PrimName;
+            Request.AttrName = Attribute.Key;
+            Request.Type = Attribute.Value;
+            Request.bAnimated = bAnimated;
+            Request.TimeSample = Time;
+        }
+
+        TArray<FUsdAttributeResult> Results;
+        UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributesBatch(StageActor, Requests, Results);
+    }
+
+    /**
+     * @brief Lists every getter of the attribute library, in the order they're declared.
+     * @param Frames The number of time samples, all of which the range getters read.
+     */
+    TArray<FGetterCase> MakeGetterCases(int32 Frames)
+    {
+        constexpr int32 BatchValues = UE_ARRAY_COUNT(BatchAttributes);
+
+        return TArray<FGetterCase>
+        {
+            USD_BENCHMARK_GETTER(GetUsdVec3Attribute, "customVec3"),
+            USD_BENCHMARK_GETTER(GetUsdFloatAttribute, "customFloat"),
+            USD_BENCHMARK_GETTER(GetUsdDoubleAttribute, "customDouble"),
+            USD_BENCHMARK_GETTER(GetUsdIntAttribute, "customInt"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedVec3Attribute, "customVec3"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedFloatAttribute, "customFloat"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedDoubleAttribute, "customDouble"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedIntAttribute, "customInt"),
+            USD_BENCHMARK_GETTER(GetUsdBoolAttribute, "customBool"),
+            USD_BENCHMARK_GETTER(GetUsdVec2Attribute, "customVec2"),
+            USD_BENCHMARK_GETTER(GetUsdVec4Attribute, "customVec4"),
+            USD_BENCHMARK_GETTER(GetUsdQuatAttribute, "customQuat"),
+            USD_BENCHMARK_GETTER(GetUsdMatrixAttribute, "customMatrix"),
+            USD_BENCHMARK_GETTER(GetUsdStringAttribute, "customString"),
+            USD_BENCHMARK_GETTER(GetUsdColorAttribute, "customColour"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedBoolAttribute, "customBool"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedVec2Attribute, "customVec2"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedVec4Attribute, "customVec4"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedQuatAttribute, "customQuat"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedMatrixAttribute, "customMatrix"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedStringAttribute, "customString"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedColorAttribute, "customColour"),
+            USD_BENCHMARK_GETTER(GetUsdFloatArrayAttribute, "customFloatArray"),
+            USD_BENCHMARK_GETTER(GetUsdIntArrayAttribute, "customIntArray"),
+            USD_BENCHMARK_GETTER(GetUsdVec2ArrayAttribute, "customVec2Array"),
+            { TEXT("GetUsdVec3ArrayAttribute"), TEXT("customVec3Array"), false, 1, [](AUsdStageActor* StageActor, const FString& PrimName, const FString& Attr, double)
+                { UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec3ArrayAttribute(StageActor, PrimName, Attr, EUsdVectorConversion::None); } },
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedFloatArrayAttribute, "customFloatArray"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedIntArrayAttribute, "customIntArray"),
+            USD_BENCHMARK_ANIMATED_GETTER(GetUsdAnimatedVec2ArrayAttribute, "customVec2Array"),
+            { TEXT("GetUsdAnimatedVec3ArrayAttribute"), TEXT("customVec3Array"), true, 1, [](AUsdStageActor* StageActor, const FString& PrimName, const FString& Attr, double Time)
+                { UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3ArrayAttribute(StageActor, PrimName, Attr, Time, EUsdVectorConversion::None); } },
+            USD_BENCHMARK_RANGE_GETTER(GetUsdAnimatedVec3AttributeRange, "customVec3"),
+            USD_BENCHMARK_RANGE_GETTER(GetUsdAnimatedFloatAttributeRange, "customFloat"),
+            USD_BENCHMARK_RANGE_GETTER(GetUsdAnimatedDoubleAttributeRange, "customDouble"),
+            USD_BENCHMARK_RANGE_GETTER(GetUsdAnimatedIntAttributeRange, "customInt"),
+            { TEXT("GetUsdAttributesBatch"), TEXT(""), false, BatchValues, [](AUsdStageActor* StageActor, const FString& PrimName, const FString&, double)
+                { ReadBatch(StageActor, PrimName, false, 0.0); } },
+            { TEXT("GetUsdAttributesBatch (animated)"), TEXT(""), true, BatchValues, [](AUsdStageActor* StageActor, const FString& PrimName, const FString&, double Time)
+                { ReadBatch(StageActor, PrimName, true, Time); } }
+        };
+    }
+
+    #undef USD_BENCHMARK_GETTER
+    #undef USD_BENCHMARK_ANIMATED_GETTER
+    #undef USD_BENCHMARK_RANGE_GETTER
+
+    double CyclesToNs(uint64 Cycles)
+    {
+        return FPlatformTime::ToSeconds64(Cycles) * 1.0e9;
+    }
+
+    FString GetBulkPrimName(int32 Index)
+    {
+        return FString::Printf(TEXT("prim_%d"), Index);
+    }
+
+    FString GetAnimatedPrimName(int32 Index)
+    {
+        return FString::Printf(TEXT("anim_%d"), Index);
+    }
+
+#if USE_USD_SDK
+    template <typename ValueType>
+    void SetAttribute(const pxr::UsdPrim& Prim, const char* Name, const pxr::SdfValueTypeName& TypeName, const ValueType& Value, pxr::UsdTimeCode Time)
+    {
+        Prim.CreateAttribute(pxr::TfToken(Name), TypeName, true).Set(Value, Time);
+    }
+
+    /**
+     * @brief Authors one value of every attribute type the getters read.
+     * @param Prim The prim to author on.
+     * @param Seed Varies the values, so animated attributes change between time samples.
+     * @param Time The time code to author the values at.
+     */
+    void AuthorAttributes(const pxr::UsdPrim& Prim, double Seed, pxr::UsdTimeCode Time)
+    {
+        const float FloatSeed = static_cast<float>(Seed);
+
+        pxr::GfMatrix4d Matrix(1.0);
+        Matrix.SetTranslateOnly(pxr::GfVec3d(Seed, Seed + 1.0, Seed + 2.0));
+
+        SetAttribute(Prim, "customFloat", pxr::SdfValueTypeNames->Float, FloatSeed, Time);
+        SetAttribute(Prim, "customDouble", pxr::SdfValueTypeNames->Double, Seed, Time);
+        SetAttribute(Prim, "customInt", pxr::SdfValueTypeNames->Int, static_cast<int>(Seed), Time);
+        SetAttribute(Prim, "customBool", pxr::SdfValueTypeNames->Bool, (static_cast<int>(Seed) & 1) != 0, Time);
+        SetAttribute(Prim, "customVec2", pxr::SdfValueTypeNames->Float2, pxr::GfVec2f(FloatSeed, FloatSeed + 1.0f), Time);
+        SetAttribute(Prim, "customVec3", pxr::SdfValueTypeNames->Float3, pxr::GfVec3f(FloatSeed, FloatSeed + 1.0f, FloatSeed + 2.0f), Time);
+        SetAttribute(Prim, "customVec4", pxr::SdfValueTypeNames->Float4, pxr::GfVec4f(FloatSeed, FloatSeed + 1.0f, FloatSeed + 2.0f, 1.0f), Time);
+        SetAttribute(Prim, "customQuat", pxr::SdfValueTypeNames->Quatf, pxr::GfQuatf(FMath::Cos(FloatSeed), 0.0f, 0.0f, FMath::Sin(FloatSeed)), Time);
+        SetAttribute(Prim, "customMatrix", pxr::SdfValueTypeNames->Matrix4d, Matrix, Time);
+        SetAttribute(Prim, "customString", pxr::SdfValueTypeNames->String, std::string(TCHAR_TO_UTF8(*FString::SanitizeFloat(Seed))), Time);
+        SetAttribute(Prim, "customColour", pxr::SdfValueTypeNames->Color3f, pxr::GfVec3f(0.5f, FMath::Frac(FloatSeed), 0.5f), Time);
+        SetAttribute(Prim, "customFloatArray", pxr::SdfValueTypeNames->FloatArray, pxr::VtFloatArray(ArrayLength, FloatSeed), Time);
+        SetAttribute(Prim, "customIntArray", pxr::SdfValueTypeNames->IntArray, pxr::VtIntArray(ArrayLength, static_cast<int>(Seed)), Time);
+        SetAttribute(Prim, "customVec2Array", pxr::SdfValueTypeNames->Float2Array, pxr::VtVec2fArray(ArrayLength, pxr::GfVec2f(FloatSeed)), Time);
+        SetAttribute(Prim, "customVec3Array", pxr::SdfValueTypeNames->Float3Array, pxr::VtVec3fArray(ArrayLength, pxr::GfVec3f(FloatSeed)), Time);
+    }
+#endif
+}
+
+UUsdAttributeBenchmarkCommandlet::UUsdAttributeBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UUsdAttributeBenchmarkCommandlet::Main(const FString& Params)
+{
+#if USE_USD_SDK
+    FString PrimCountsParam = TEXT("1000,10000,100000");
+    FParse::Value(*Params, TEXT("PrimCounts="), PrimCountsParam);
+    FParse::Value(*Params, TEXT("Frames="), Frames);
+    FParse::Value(*Params, TEXT("AnimatedPrims="), AnimatedPrims);
+    FParse::Value(*Params, TEXT("ColdSamples="), ColdSamples);
+    FParse::Value(*Params, TEXT("WarmIterations="), WarmIterations);
+    FParse::Value(*Params, TEXT("ScanIterations="), ScanIterations);
+
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("UsdAttributeBenchmark") / TEXT("Results.json");
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    Frames = FMath::Max(Frames, 2);
+    AnimatedPrims = FMath::Max(AnimatedPrims, 1);
+    ColdSamples = FMath::Max(ColdSamples, 1);
+    WarmIterations = FMath::Max(WarmIterations, 1);
+    ScanIterations = FMath::Max(ScanIterations, 1);
+
+    TArray<FString> PrimCounts;
+    PrimCountsParam.ParseIntoArray(PrimCounts, TEXT(","));
+
+    // The stage actor needs a world to spawn in, which isn't loaded for commandlets
+    UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("UsdAttributeBenchmark"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+    WorldContext.SetCurrentWorld(World);
+
+    TArray<TSharedPtr<FJsonValue>> StageResults;
+    for (const FString& PrimCount : PrimCounts)
+    {
+        const int32 NumPrims = FCString::Atoi(*PrimCount);
+        if (NumPrims <= 0)
+        {
+            UE_LOG(LogUsdAttributeBenchmark, Warning, TEXT("Skipping invalid prim count: %s"), *PrimCount);
+            continue;
+        }
+
+        if (TSharedPtr<FJsonObject> StageResult = RunStage(World, NumPrims))
+        {
+            StageResults.Add(MakeShared<FJsonValueObject>(StageResult));
+        }
+    }
+
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+    Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+    Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+    Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Root->SetNumberField(TEXT("frames"), Frames);
+    Root->SetNumberField(TEXT("animatedPrims"), AnimatedPrims);
+    Root->SetNumberField(TEXT("coldSamples"), ColdSamples);
+    Root->SetNumberField(TEXT("warmIterations"), WarmIterations);
+    Root->SetArrayField(TEXT("stages"), StageResults);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+    {
+        UE_LOG(LogUsdAttributeBenchmark, Error, TEXT("Failed to write the results to %s"), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogUsdAttributeBenchmark, Display, TEXT("Wrote the results for %d stages to %s"), StageResults.Num(), *OutputPath);
+    return StageResults.Num() == PrimCounts.Num() ? 0 : 1;
+#else
+    UE_LOG(LogUsdAttributeBenchmark, Error, TEXT("USE_USD_SDK not enabled, unable to benchmark the attribute library"));
+    return 1;
+#endif
+}
+
+TSharedPtr<FJsonObject> UUsdAttributeBenchmarkCommandlet::RunStage(UWorld* World, int32 NumPrims)
+{
+#if USE_USD_SDK
+    using namespace UsdAttributeBenchmarkImpl;
+
+    const uint64 AuthorStart = FPlatformTime::Cycles64();
+    pxr::UsdStageRefPtr Stage = AuthorStage(NumPrims);
+    if (!Stage)
+    {
+        UE_LOG(LogUsdAttributeBenchmark, Error, TEXT("Failed to author the stage for %d prims"), NumPrims);
+        return nullptr;
+    }
+    const double AuthorSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - AuthorStart);
+
+    // The stage lives in the stage cache the actor opens from, so it's opened by the identifier of its anonymous root layer
+    const FString Identifier = UTF8_TO_TCHAR(Stage->GetRootLayer()->GetIdentifier().c_str());
+
+    const uint64 LoadStart = FPlatformTime::Cycles64();
+    AUsdStageActor* StageActor = World->SpawnActor<AUsdStageActor>();
+    StageActor->SetRootLayer(FString(UnrealIdentifiers::IdentifierPrefix) + Identifier);
+    const double LoadSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - LoadStart);
+
+    if (!StageActor->GetUsdStage())
+    {
+        UE_LOG(LogUsdAttributeBenchmark, Error, TEXT("Failed to open the in-memory stage %s"), *Identifier);
+        World->DestroyActor(StageActor);
+        pxr::UsdUtilsStageCache::Get().Erase(Stage);
+        return nullptr;
+    }
+
+    const int32 NumShots = FMath::Max(NumPrims / PrimsPerShot, 1);
+    const int32 NumBulkPrims = NumShots * (PrimsPerShot - 1);
+    UE_LOG(LogUsdAttributeBenchmark, Display, TEXT("Benchmarking %d prims, authored in %.2f s and opened in %.2f s"), NumPrims, AuthorSeconds, LoadSeconds);
+
+    TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetNumberField(TEXT("prims"), NumPrims);
+    Result->SetNumberField(TEXT("cameras"), NumShots);
+    Result->SetNumberField(TEXT("authorSeconds"), AuthorSeconds);
+    Result->SetNumberField(TEXT("loadSeconds"), LoadSeconds);
+
+    // The indices are built by the first lookup after the caches are dropped
+    {
+        FUsdAttributeStageCache::ResetAll();
+        const uint64 Start = FPlatformTime::Cycles64();
+        UUsdAttributeFunctionLibraryBPLibrary::FindUsdPrimPaths(StageActor, GetBulkPrimName(0));
+        Result->SetNumberField(TEXT("nameIndexBuildNs"), CyclesToNs(FPlatformTime::Cycles64() - Start));
+    }
+    {
+        TArray<FString> AttrNames;
+        uint64 Start = FPlatformTime::Cycles64();
+        UUsdAttributeFunctionLibraryBPLibrary::FindUsdPrimsWithAttribute(StageActor, TEXT("cameraNumber"), true, AttrNames);
+        Result->SetNumberField(TEXT("attributeIndexBuildNs"), CyclesToNs(FPlatformTime::Cycles64() - Start));
+
+        Start = FPlatformTime::Cycles64();
+        UUsdAttributeFunctionLibraryBPLibrary::FindUsdPrimsWithAttribute(StageActor, TEXT("cameraNumber"), true, AttrNames);
+        Result->SetNumberField(TEXT("attributeQueryNs"), CyclesToNs(FPlatformTime::Cycles64() - Start));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> GetterResults;
+    for (const FGetterCase& Case : MakeGetterCases(Frames))
+    {
+        const int32 NumCandidates = Case.bAnimated ? AnimatedPrims : NumBulkPrims;
+        auto GetPrimName = [&Case](int32 Index)
+        {
+            return Case.bAnimated ? GetAnimatedPrimName(Index) : GetBulkPrimName(Index);
+        };
+
+        // Cold: every read is of a prim that hasn't been read since the caches were dropped.
+        // The name index is rebuilt beforehand so that its cost isn't folded into the first read
+        FUsdAttributeStageCache::ResetAll();
+        UUsdAttributeFunctionLibraryBPLibrary::FindUsdPrimPaths(StageActor, GetBulkPrimName(0));
+
+        const int32 NumCold = FMath::Min(ColdSamples, NumCandidates);
+        TArray<FString> ColdPrimNames;
+        ColdPrimNames.Reserve(NumCold);
+        for (int32 Index = 0; Index < NumCold; ++Index)
+        {
+            ColdPrimNames.Add(GetPrimName(static_cast<int32>(static_cast<int64>(Index) * NumCandidates / NumCold)));
+        }
+
+        const FString AttrName = Case.AttrName;
+        uint64 Start = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumCold; ++Index)
+        {
+            Case.Call(StageActor, ColdPrimNames[Index], AttrName, static_cast<double>(Index % Frames));
+        }
+        const double ColdNs = CyclesToNs(FPlatformTime::Cycles64() - Start) / NumCold;
+
+        // Warm: one prim read at every frame in turn, as during playback
+        const FString WarmPrimName = GetPrimName(0);
+        Case.Call(StageActor, WarmPrimName, AttrName, 0.0);
+
+        const int32 NumWarm = FMath::Max(WarmIterations / Case.ValuesPerCall, 1);
+        Start = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumWarm; ++Index)
+        {
+            Case.Call(StageActor, WarmPrimName, AttrName, static_cast<double>(Index % Frames));
+        }
+        const double WarmNs = CyclesToNs(FPlatformTime::Cycles64() - Start) / NumWarm;
+
+        TSharedRef<FJsonObject> GetterResult = MakeShared<FJsonObject>();
+        GetterResult->SetStringField(TEXT("name"), Case.Name);
+        GetterResult->SetNumberField(TEXT("valuesPerCall"), Case.ValuesPerCall);
+        GetterResult->SetNumberField(TEXT("coldNsPerOp"), ColdNs);
+        GetterResult->SetNumberField(TEXT("warmNsPerOp"), WarmNs);
+        GetterResults.Add(MakeShared<FJsonValueObject>(GetterResult));
+
+        UE_LOG(LogUsdAttributeBenchmark, Display, TEXT("  %-40s cold %10.0f ns/op  warm %10.0f ns/op"), Case.Name, ColdNs, WarmNs);
+    }
+    Result->SetArrayField(TEXT("getters"), GetterResults);
+
+    const double ScanNs = TimeCameraScan(StageActor);
+    Result->SetNumberField(TEXT("cameraScanNsPerOp"), ScanNs);
+    UE_LOG(LogUsdAttributeBenchmark, Display, TEXT("  %-40s %10.0f ns/op"), TEXT("GetCamerasFromUSDStage"), ScanNs);
+
+    FUsdAttributeStageCache::ResetAll();
+    World->DestroyActor(StageActor);
+    pxr::UsdUtilsStageCache::Get().Erase(Stage);
+    return Result;
+#else
+    return nullptr;
+#endif
+}
+
+#if USE_USD_SDK
+pxr::UsdStageRefPtr UUsdAttributeBenchmarkCommandlet::AuthorStage(int32 NumPrims) const
+{
+    using namespace UsdAttributeBenchmarkImpl;
+
+    pxr::UsdStageRefPtr Stage;
+    {
+        pxr::UsdStageCacheContext CacheContext(pxr::UsdUtilsStageCache::Get());
+        Stage = pxr::UsdStage::CreateInMemory();
+    }
+    if (!Stage)
+    {
+        return nullptr;
+    }
+
+    Stage->SetStartTimeCode(0.0);
+    Stage->SetEndTimeCode(Frames - 1);
+
+    const pxr::UsdGeomXform World = pxr::UsdGeomXform::Define(Stage, pxr::SdfPath("/World"));
+    Stage->SetDefaultPrim(World.GetPrim());
+
+    const int32 NumShots = FMath::Max(NumPrims / PrimsPerShot, 1);
+    int32 BulkIndex = 0;
+    for (int32 Shot = 0; Shot < NumShots; ++Shot)
+    {
+        const pxr::SdfPath ShotPath = pxr::SdfPath("/World").AppendChild(pxr::TfToken(TCHAR_TO_UTF8(*FString::Printf(TEXT("shot_%d"), Shot))));
+        pxr::UsdGeomScope::Define(Stage, ShotPath);
+
+        // Scopes carry no geometry or transform, keeping large stages quick to author and open
+        for (int32 Index = 1; Index < PrimsPerShot; ++Index, ++BulkIndex)
+        {
+            const pxr::UsdPrim Prim = pxr::UsdGeomScope::Define(Stage, ShotPath.AppendChild(pxr::TfToken(TCHAR_TO_UTF8(*GetBulkPrimName(BulkIndex))))).GetPrim();
+            AuthorAttributes(Prim, BulkIndex, pxr::UsdTimeCode::Default());
+        }
+
+        const pxr::UsdGeomCamera Camera = pxr::UsdGeomCamera::Define(Stage, ShotPath.AppendChild(pxr::TfToken("camera")));
+        SetAttribute(Camera.GetPrim(), "cameraNumber", pxr::SdfValueTypeNames->Int, Shot, pxr::UsdTimeCode::Default());
+
+        const pxr::UsdGeomXformOp Translate = Camera.AddTranslateOp();
+        const pxr::UsdGeomXformOp Rotate = Camera.AddRotateXYZOp();
+        const pxr::UsdAttribute FocalLength = Camera.CreateFocalLengthAttr();
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            const pxr::UsdTimeCode Time(Frame);
+            Translate.Set(pxr::GfVec3d(Frame, Shot, 100.0), Time);
+            Rotate.Set(pxr::GfVec3f(0.0f, Frame * 0.1f, 0.0f), Time);
+            FocalLength.Set(35.0f + (Frame % 50), Time);
+        }
+    }
+
+    const pxr::SdfPath AnimatedPath("/World/animated");
+    pxr::UsdGeomScope::Define(Stage, AnimatedPath);
+    for (int32 Index = 0; Index < AnimatedPrims; ++Index)
+    {
+        const pxr::UsdPrim Prim = pxr::UsdGeomScope::Define(Stage, AnimatedPath.AppendChild(pxr::TfToken(TCHAR_TO_UTF8(*GetAnimatedPrimName(Index))))).GetPrim();
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            AuthorAttributes(Prim, Index + Frame * 0.01, pxr::UsdTimeCode(Frame));
+        }
+    }
+
+    return Stage;
+}
+#endif
+
+double UUsdAttributeBenchmarkCommandlet::TimeCameraScan(AUsdStageActor* StageActor) const
+{
+    // The scan reads from the stage actor the tool has picked, so point it at ours for the duration
+    FUSDCameraFrameRangesModule& Module = FModuleManager::LoadModuleChecked<FUSDCameraFrameRangesModule>(TEXT("USDCameraFrameRanges"));
+    TObjectPtr<AUsdStageActor> PreviousStageActor = Module.StageActor;
+    Module.StageActor = StageActor;
+
+    const uint64 Start = FPlatformTime::Cycles64();
+    for (int32 Index = 0; Index < ScanIterations; ++Index)
+    {
+        Module.GetCamerasFromUSDStage();
+    }
+    const double ScanNs = UsdAttributeBenchmarkImpl::CyclesToNs(FPlatformTime::Cycles64() - Start) / ScanIterations;
+
+    Module.StageActor = PreviousStageActor;
+    return ScanNs;
+}
@@ -2,10 +2,20 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/FrameNumber.h"
+#include "Engine/StreamableManager.h"
+#include "Widgets/Views/SHeaderRow.h"
 #include "UsdWrappers/UsdAttribute.h" // Necessary include for FUsdAttribute
 #include "UsdWrappers/SdfPath.h" // Necessary include for FSdfPath
+#include "UsdPrimNameIndex.h" // Necessary include for TUsdPathKeyFuncs
+#include "UsdStageActorEventBinding.h" // Necessary include for FUsdStageActorEventBinding
 
 class ACineCameraActor;
+class ULevelSequence;
+class ITableRow;
+class SEditableTextBox;
+class STableViewBase;
+template <typename ItemType> class SListView;
 
 namespace UE
 {
@@ -14,6 +24,11 @@ namespace UE
     class FUsdAttribute;
 }
 
+namespace UsdKeyReduction
+{
+    struct FKeyReductionStats;
+}
+
 class FToolBarBuilder;
 class FMenuBuilder;
 class AUsdStageActor;
@@ -25,15 +40,15 @@ class AUsdStageActor;
 struct FCameraInfo
 {
     FString CameraName;
-    UE::FSdfPath* PrimPath;
+    UE::FSdfPath PrimPath;
     UE::FUsdAttribute Translation;
     UE::FUsdAttribute Rotation;
     TArray<double> RotTimeSamples;
     TArray<double> TransTimeSamples;
     int32 StartFrame;
     int32 EndFrame;
-    int32 CameraMainStartFrame;
-    int32 CameraMainEndFrame;
+    /** Every frame range cameraMain cuts to this camera for, in order. */
+    TArray<FInt32Interval> CameraMainRanges;
     bool inCameraMain = false;
     float FocalLength;
     float FocusDistance;
@@ -42,6 +57,32 @@ struct FCameraInfo
     float VerticalAperture;
 };
 
+/**
+ * @struct FCameraCut
+ * @brief A run of frames for which cameraMain's cameraNumber holds one value.
+ */
+struct FCameraCut
+{
+    int32 CameraNumber = 0;
+    int32 StartFrame = 0;
+    int32 EndFrame = 0;
+
+    /** Index of the camera named camera<CameraNumber>, or INDEX_NONE if there is none. */
+    int32 CameraIndex = INDEX_NONE;
+};
+
+/**
+ * @struct FCameraBakeSamples
+ * @brief The transform of a camera at each of its time samples, converted to the frames and channel values of a level sequence.
+ */
+struct FCameraBakeSamples
+{
+    TArray<FFrameNumber> TranslateFrames;
+    TArray<double> TranslateValues[3];
+    TArray<FFrameNumber> RotateFrames;
+    TArray<double> RotateValues[3];
+};
+
 /**
  * @struct FMaterialInfo
  * @brief Contains information about a material found within the Usd Stage and if there is a matching material within the Unreal project
@@ -52,6 +93,38 @@ struct FMaterialInfo
     FString MatName;
     bool bMatchFound = false;
     UE::FSdfPath PrimPath;
+
+    /** The material slot on the prim's component, which is the subset's index for materials bound to a GeomSubset. */
+    int32 MaterialSlot = 0;
+};
+
+/**
+ * @enum EUsdStageScanContents
+ * @brief Selects what a stage scan collects, so that callers only pay for reading what they use.
+ */
+enum class EUsdStageScanContents : uint8
+{
+    None = 0,
+    Cameras = 1 << 0,
+    Materials = 1 << 1,
+    All = Cameras | Materials
+};
+ENUM_CLASS_FLAGS(EUsdStageScanContents);
+
+/**
+ * @struct FUsdStageScan
+ * @brief Everything the tool reads from the Usd Stage, collected in a single traversal.
+ */
+struct FUsdStageScan
+{
+    /** The cameras on the stage with their time samples, frame ranges and intrinsics, in traversal order. */
+    TArray<FCameraInfo> Cameras;
+
+    /** The shaders bound to each gprim and its GeomSubsets, in traversal order. */
+    TArray<FMaterialInfo> Materials;
+
+    /** The cameraNumber attribute of the first prim named cameraMain, which is invalid if there is none. */
+    UE::FUsdAttribute CameraMainNumber;
 };
 
 /**
@@ -93,6 +166,53 @@ public:
      */
     TObjectPtr<AUsdStageActor> StageActor;
 
+    /**
+     * @brief Largest error, in cm or degrees, allowed when reducing the keys of a bake. 0 keys every sample.
+     */
+    float KeyReductionTolerance = 0.0f;
+
+    /**
+     * @brief The cameras found on the stage, shared with the rows of the camera list.
+     */
+    TArray<TSharedPtr<FCameraInfo>> CameraRecords;
+
+    /**
+     * @brief The camera records keyed by prim path, to find the record an edit to the stage affects.
+     * Keyed by SdfPath rather than FString, whose map keys compare case insensitively unlike Usd paths.
+     */
+    TMap<pxr::SdfPath, TSharedPtr<FCameraInfo>, FDefaultSetAllocator, TUsdPathKeyFuncs<TSharedPtr<FCameraInfo>>> CameraRecordsByPath;
+
+    /**
+     * @brief The cameraNumber attribute of cameraMain, kept to recompute the cuts when it is edited.
+     */
+    UE::FUsdAttribute CameraMainNumber;
+
+    /**
+     * @brief The cameras passing the text filter, in the order of the sort column, which the camera list shows.
+     */
+    TArray<TSharedPtr<FCameraInfo>> FilteredCameraRecords;
+
+    /**
+     * @brief The camera list of the tab.
+     */
+    TSharedPtr<SListView<TSharedPtr<FCameraInfo>>> CameraListView;
+
+    /**
+     * @brief The level sequence path input of the tab, read when a row's duplicate button is clicked.
+     */
+    TSharedPtr<SEditableTextBox> LevelSequencePathTextBox;
+
+    /**
+     * @brief Text a camera's name must contain to be listed.
+     */
+    FString CameraFilterText;
+
+    /**
+     * @brief The column the camera list is sorted by, and in which direction.
+     */
+    FName CameraSortColumn;
+    EColumnSortMode::Type CameraSortMode = EColumnSortMode::None;
+
     /**
      * @brief Spawns the plugin tab in the editor.
      * @param SpawnTabArgs Arguments for spawning the tab.
@@ -106,6 +226,51 @@ public:
      */
     static TObjectPtr<AUsdStageActor> FindUsdStageActor();
 
+    /**
+     * @brief Builds the row widget for a camera when it scrolls into view.
+     * @param Camera The camera record shown by the row.
+     * @param OwnerTable The list view that owns the row.
+     * @return The row widget.
+     */
+    TSharedRef<ITableRow> OnGenerateCameraRow(TSharedPtr<FCameraInfo> Camera, const TSharedRef<STableViewBase>& OwnerTable);
+
+    /**
+     * @brief Sorts the camera list by a column when its header is clicked.
+     * @param SortPriority Unused, the list is only sorted by one column.
+     * @param ColumnId The column to sort by.
+     * @param NewSortMode Whether to sort ascending or descending.
+     */
+    void OnCameraListSorted(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+
+    /**
+     * @brief Rebuilds the cameras shown by the camera list, applying the text filter and sort column.
+     */
+    void RefreshCameraList();
+
+    /**
+     * @brief Scans the whole stage for cameras and cameraMain, replacing every camera record.
+     */
+    void RebuildCameraRecords();
+
+    /**
+     * @brief Binds to the stage actor's events, so the camera records follow stage reloads and prim edits.
+     */
+    void BindStageActorEvents();
+
+    /**
+     * @brief Updates only the camera records affected by an edit to the stage.
+     * @param PrimPath The path of the changed prim, or of the changed property.
+     * @param bResync Whether the prim's subtree was recomposed, rather than only its values changed.
+     */
+    void HandlePrimChanged(const FString& PrimPath, bool bResync);
+
+    /**
+     * @brief Walks the Usd stage once, collecting cameras, the cameraMain prim and material bindings.
+     * @param Contents What to collect, the cameraMain prim is always found.
+     * @return The collected stage information.
+     */
+    FUsdStageScan ScanStage(EUsdStageScanContents Contents = EUsdStageScanContents::All) const;
+
     /**
      * @brief Retrieves all cameras from the Usd stage.
      * @return An array of camera information extracted from the USD stage.
@@ -114,9 +279,11 @@ public:
 
     /**
      * @brief Finds the frame ranges from cameraMain camera number attribute.
-     * @param Cameras reference to array containing camera information in the Usd.
+     * @param Cameras The camera records of the cameras in the Usd, whose cameraMain ranges are replaced.
+     * @param CameraNumberAttr The cameraNumber attribute of cameraMain, as found by ScanStage.
+     * @return The cuts of cameraMain in frame order.
      */
-    void FindCameraMainFrameRanges(TArray<FCameraInfo>& Cameras);
+    TArray<FCameraCut> FindCameraMainFrameRanges(const TArray<TSharedPtr<FCameraInfo>>& Cameras, const UE::FUsdAttribute& CameraNumberAttr);
 
 
     /**
@@ -127,6 +294,22 @@ public:
         */
     FReply OnDuplicateButtonClicked(FCameraInfo Camera, FString LevelSequencePath);
 
+    /**
+     * @brief Handles the button click event for duplicating every selected Usd camera at once.
+     * @param Cameras The Usd cameras selected in the tab's camera list.
+     * @param LevelSequencePath The path to the level sequence the cameras are baked into.
+     * @return The reply indicating the result of the button click.
+     */
+    FReply OnDuplicateSelectedButtonClicked(TArray<FCameraInfo> Cameras, FString LevelSequencePath);
+
+    /**
+     * @brief Spawns a CineCameraActor matching a Usd camera's first frame and intrinsics.
+     * @param World The world to spawn the camera in.
+     * @param Camera The Usd camera information to duplicate.
+     * @return The new camera, or nullptr if it couldn't be spawned.
+     */
+    TObjectPtr<ACineCameraActor> SpawnDuplicateCamera(UWorld* World, const FCameraInfo& Camera);
+
     /**
      * @brief Handles the button click event for swapping materials.
      * @return The reply indicating the result of the button click.
@@ -149,32 +332,36 @@ public:
     FReply OnDisableManualFocusButtonClicked();
 
     /**
-     * @brief Traverses the Usd prim hierarchy and collects camera paths.
-     * @param CurrentPrim The current Usd prim being traversed.
-     * @param OutCameraPaths Array to store the collected camera paths.
+     * @brief Finds every material in the project's material folder from the asset registry, without loading them.
+     * @return The path of each material, keyed by its name.
      */
-    static void TraverseAndCollectCameras(const UE::FUsdPrim& CurrentPrim, TArray<UE::FSdfPath>& OutCameraPaths);
+    TMap<FString, FSoftObjectPath> GetAllMaterials();
 
     /**
-     * @brief Traverses the Usd prim hierarchy and collects material information.
-     * @param CurrentPrim The current Usd prim being traversed.
-     * @param MaterialNames Array to store the collected material information.
+     * @brief Adds a duplicate Usd camera to a level sequence with all of its keyframes.
+     * @param LevelSequencePath The path to the level sequence where the camera will be added.
+     * @param CameraActor The CineCameraActor to be added.
+     * @param Camera The camera information to be added.
      */
-    void TraverseAndCollectMaterials(const UE::FUsdPrim& CurrentPrim, TArray<FMaterialInfo>& MaterialNames);
+    void AddCameraToLevelSequence(const FString& LevelSequencePath, const TObjectPtr<ACineCameraActor>& CameraActor, FCameraInfo Camera);
 
     /**
-     * @brief Retrieves all materials from the project.
-     * @return An array of pointers to all materials in the project.
+     * @brief Adds a duplicate Usd camera to a loaded level sequence, keyed from samples that were already read.
+     * @param LevelSequence The level sequence the camera will be added to.
+     * @param CameraActor The CineCameraActor to be added.
+     * @param Camera The camera information to be added.
+     * @param Samples The camera's transform samples, as read by SampleCameraAnimation.
+     * @param Stats Accumulates the key counts before and after reduction.
      */
-    TArray<UMaterial*>* GetAllMaterials();
+    void BakeCameraToLevelSequence(ULevelSequence* LevelSequence, const TObjectPtr<ACineCameraActor>& CameraActor, const FCameraInfo& Camera, const FCameraBakeSamples& Samples, UsdKeyReduction::FKeyReductionStats& Stats);
 
     /**
-     * @brief Adds a duplicate Usd camera to a level sequence with all of its keyframes.
-     * @param LevelSequencePath The path to the level sequence where the camera will be added.
-     * @param CameraActor The CineCameraActor to be added.
-     * @param Camera The camera information to be added.
+     * @brief Reads a camera's transform at each of its time samples, directly off its attributes so it is safe on worker threads.
+     * @param Camera The camera whose translation and rotation are read.
+     * @param TicksPerFrame The ticks per display frame of the level sequence the samples are keyed into.
+     * @param OutSamples Receives the frames and channel values.
      */
-    void AddCameraToLevelSequence(const FString& LevelSequencePath, const TObjectPtr<ACineCameraActor>& CameraActor, FCameraInfo Camera);
+    static void SampleCameraAnimation(const FCameraInfo& Camera, int32 TicksPerFrame, FCameraBakeSamples& OutSamples);
 
     /**
      * @brief Disables manual focus on a CineCameraActor.
@@ -188,4 +375,19 @@ private:
      * @brief The command list for plugin UI commands.
      */
     TSharedPtr<class FUICommandList> PluginCommands;
+
+    /**
+     * @brief Loads the materials matched by the material swap in the background.
+     */
+    FStreamableManager StreamableManager;
+
+    /**
+     * @brief The load of the last material swap, which a new swap cancels.
+     */
+    TSharedPtr<FStreamableHandle> MaterialSwapHandle;
+
+    /**
+     * @brief The tab's bindings to the events of the stage actor.
+     */
+    FUsdStageActorEventBinding StageActorEvents;
 };
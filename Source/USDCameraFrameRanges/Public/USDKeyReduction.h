@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+
+/**
+ * Reduces densely sampled animation to the keys needed to reproduce it within a tolerance.
+ *
+ * The bakes sample one value per Usd time sample, so a camera carries a key per frame on every channel
+ * even where it is held or moving steadily. Runs of held values are replaced by a single constant key
+ * and runs lying on a straight line by a single linear key, with every dropped sample evaluating within
+ * the tolerance of its original value.
+ */
+namespace UsdKeyReduction
+{
+    /**
+     * @struct FReducedKey
+     * @brief A sample kept by the reduction, along with how to interpolate from it to the next kept key.
+     */
+    struct FReducedKey
+    {
+        int32 SampleIndex = 0;
+        ERichCurveInterpMode InterpMode = RCIM_Constant;
+    };
+
+    /**
+     * @struct FKeyReductionStats
+     * @brief Key counts before and after reduction, accumulated over every channel of a bake.
+     */
+    struct FKeyReductionStats
+    {
+        int32 KeysBefore = 0;
+        int32 KeysAfter = 0;
+    };
+
+    /**
+     * @brief Finds the keys needed to reproduce sampled values within a tolerance.
+     *
+     * Greedily extends each key as far as the samples after it can be reproduced, either held or on the
+     * line to the next kept key. The lines allowed by the samples passed so far are tracked as a running
+     * range of slopes, and a key stops at the first sample that can't end it, so each sample is checked
+     * at most twice and the reduction is linear in the number of samples. The first and last samples
+     * are always kept.
+     *
+     * @param Times The time of each sample, in increasing order.
+     * @param Values The value of each sample.
+     * @param Tolerance The largest difference allowed between a dropped sample and the reduced curve.
+     * @param OutKeys Receives the kept keys, in increasing order.
+     */
+    void ReduceKeys(TArrayView<const double> Times, TArrayView<const double> Values, double Tolerance, TArray<FReducedKey>& OutKeys);
+}
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/stage.h"
+#include "USDIncludesEnd.h"
+#endif
+
+#include "UsdAttributeBenchmarkCommandlet.generated.h"
+
+class AUsdStageActor;
+class FJsonObject;
+
+/**
+ * @class UUsdAttributeBenchmarkCommandlet
+ * @brief Measures attribute lookup and sampling on synthetic stages, writing the results as JSON so regressions can be tracked.
+ *
+ * For each requested prim count a stage is authored in memory and opened in a UsdStageActor in a
+ * transient world, so nothing is written to disk but the results. Every getter of UUsdAttributeFunctionLibraryBPLibrary is then timed
+ * in ns/op both cold, reading each prim once after dropping every cache, and warm, reading one prim
+ * repeatedly as during playback. The camera scan of FUSDCameraFrameRangesModule is timed as well.
+ *
+ * Runs headless:
+ *     UnrealEditor-Cmd Project.uproject -run=UsdAttributeBenchmark -nullrhi -unattended
+ *         [-PrimCounts=1000,10000,100000] [-Frames=1000] [-AnimatedPrims=64] [-ColdSamples=1000]
+ *         [-WarmIterations=10000] [-ScanIterations=3] [-Output=Path/To/Results.json]
+ */
+UCLASS()
+class UUsdAttributeBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UUsdAttributeBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    /**
+     * @brief Authors a synthetic stage, opens it and times every getter and the camera scan against it.
+     * @param World The transient world to spawn the stage actor in.
+     * @param NumPrims The number of prims to author.
+     * @return The results for the stage, or nullptr if it couldn't be authored or opened.
+     */
+    TSharedPtr<FJsonObject> RunStage(UWorld* World, int32 NumPrims);
+
+#if USE_USD_SDK
+    /**
+     * @brief Authors a synthetic stage in memory.
+     *
+     * Prims are grouped in shots of 100 under /World, each shot holding one camera animated over every
+     * frame and 99 scopes authoring one static attribute of every type the getters read. A further
+     * AnimatedPrims scopes under /World/animated author the same attributes with a time sample per frame.
+     *
+     * The stage is created in the Usd stage cache so a stage actor can open it, and must be erased
+     * from the cache once done with.
+     *
+     * @param NumPrims The number of prims to author.
+     * @return The stage, or nullptr if it couldn't be created.
+     */
+    pxr::UsdStageRefPtr AuthorStage(int32 NumPrims) const;
+#endif
+
+    /**
+     * @brief Times the camera scan of the frame ranges tool.
+     * @param StageActor The stage actor to scan.
+     * @return The average duration of a scan in ns.
+     */
+    double TimeCameraScan(AUsdStageActor* StageActor) const;
+
+    int32 Frames = 1000;
+    int32 AnimatedPrims = 64;
+    int32 ColdSamples = 1000;
+    int32 WarmIterations = 10000;
+    int32 ScanIterations = 3;
+};
@@ -54,6 +54,8 @@ public class USDCameraFrameRanges : ModuleRules
 				"MovieSceneTracks",
 				"LevelSequence", 
 				"UsdAttributeFunctionLibrary",
+				"Json",
+				"AssetRegistry",
 				
 				// ... add private dependencies that you statically link with here ...	
 			}
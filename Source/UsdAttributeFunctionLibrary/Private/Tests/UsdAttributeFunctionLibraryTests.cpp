@@ -0,0 +1,283 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeFunctionLibraryBPLibrary.h"
+#include "UsdAttributeStageCache.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && USE_USD_SDK
+
+#include "UnrealUSDWrapper.h"
+#include "USDStageActor.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/quatf.h"
+#include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec4f.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usd/stageCacheContext.h"
+#include "pxr/usd/usdGeom/scope.h"
+#include "pxr/usd/usdUtils/stageCache.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdAttributeFunctionLibraryTestsImpl
+{
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter;
+
+    /**
+     * @class FScopedTestStage
+     * @brief An in-memory stage opened in a stage actor of a transient world, all torn down on destruction.
+     *
+     * The stage is created in the stage cache the stage actor opens from, so nothing is written to disk.
+     * Author the stage through Stage before calling Open.
+     */
+    class FScopedTestStage
+    {
+    public:
+        FScopedTestStage()
+        {
+            {
+                pxr::UsdStageCacheContext CacheContext(pxr::UsdUtilsStageCache::Get());
+                Stage = pxr::UsdStage::CreateInMemory();
+            }
+
+            World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("UsdAttributeTests"));
+            FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+            WorldContext.SetCurrentWorld(World);
+        }
+
+        ~FScopedTestStage()
+        {
+            FUsdAttributeStageCache::ResetAll();
+            if (StageActor)
+            {
+                World->DestroyActor(StageActor);
+            }
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+            pxr::UsdUtilsStageCache::Get().Erase(Stage);
+        }
+
+        /** @return The stage actor the stage was opened in, or nullptr if it couldn't be opened. */
+        AUsdStageActor* Open()
+        {
+            StageActor = World->SpawnActor<AUsdStageActor>();
+            StageActor->SetRootLayer(FString(UnrealIdentifiers::IdentifierPrefix) + UTF8_TO_TCHAR(Stage->GetRootLayer()->GetIdentifier().c_str()));
+            return StageActor->GetUsdStage() ? StageActor : nullptr;
+        }
+
+        /** Defines a scope prim, which carries no geometry or transform. */
+        pxr::UsdPrim DefinePrim(const char* Path) const
+        {
+            return pxr::UsdGeomScope::Define(Stage, pxr::SdfPath(Path)).GetPrim();
+        }
+
+        pxr::UsdStageRefPtr Stage;
+
+    private:
+        UWorld* World = nullptr;
+        AUsdStageActor* StageActor = nullptr;
+    };
+
+    template <typename ValueType>
+    void SetAttribute(const pxr::UsdPrim& Prim, const char* Name, const pxr::SdfValueTypeName& TypeName, const ValueType& Value, pxr::UsdTimeCode Time = pxr::UsdTimeCode::Default())
+    {
+        Prim.CreateAttribute(pxr::TfToken(Name), TypeName, true).Set(Value, Time);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUsdAttributeStaticGettersTest, "UsdAttributeTools.AttributeLibrary.StaticGetters", UsdAttributeFunctionLibraryTestsImpl::TestFlags)
+
+bool FUsdAttributeStaticGettersTest::RunTest(const FString& Parameters)
+{
+    using namespace UsdAttributeFunctionLibraryTestsImpl;
+    using Library = UUsdAttributeFunctionLibraryBPLibrary;
+
+    FScopedTestStage TestStage;
+    const pxr::UsdPrim Prim = TestStage.DefinePrim("/World/props/lamp");
+
+    pxr::GfMatrix4d Matrix(1.0);
+    Matrix.SetTranslateOnly(pxr::GfVec3d(10.0, 20.0, 30.0));
+
+    SetAttribute(Prim, "customFloat", pxr::SdfValueTypeNames->Float, 1.5f);
+    SetAttribute(Prim, "customDouble", pxr::SdfValueTypeNames->Double, 2.25);
+    SetAttribute(Prim, "customInt", pxr::SdfValueTypeNames->Int, 7);
+    SetAttribute(Prim, "customBool", pxr::SdfValueTypeNames->Bool, true);
+    SetAttribute(Prim, "customVec2", pxr::SdfValueTypeNames->Float2, pxr::GfVec2f(1.0f, 2.0f));
+    SetAttribute(Prim, "customVec3", pxr::SdfValueTypeNames->Float3, pxr::GfVec3f(1.0f, 2.0f, 3.0f));
+    SetAttribute(Prim, "customVec4", pxr::SdfValueTypeNames->Float4, pxr::GfVec4f(1.0f, 2.0f, 3.0f, 4.0f));
+    SetAttribute(Prim, "customQuat", pxr::SdfValueTypeNames->Quatf, pxr::GfQuatf(0.5f, 0.5f, 0.5f, 0.5f));
+    SetAttribute(Prim, "customMatrix", pxr::SdfValueTypeNames->Matrix4d, Matrix);
+    SetAttribute(Prim, "customString", pxr::SdfValueTypeNames->String, std::string("shot010"));
+    SetAttribute(Prim, "customColour", pxr::SdfValueTypeNames->Color3f, pxr::GfVec3f(0.25f, 0.5f, 0.75f));
+
+    AUsdStageActor* StageActor = TestStage.Open();
+    if (!TestNotNull(TEXT("Stage actor with the in-memory stage"), StageActor))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Float"), Library::GetUsdFloatAttribute(StageActor, TEXT("lamp"), TEXT("customFloat")), 1.5f);
+    TestEqual(TEXT("Double"), Library::GetUsdDoubleAttribute(StageActor, TEXT("lamp"), TEXT("customDouble")), 2.25);
+    TestEqual(TEXT("Int"), Library::GetUsdIntAttribute(StageActor, TEXT("lamp"), TEXT("customInt")), 7);
+    TestTrue(TEXT("Bool"), Library::GetUsdBoolAttribute(StageActor, TEXT("lamp"), TEXT("customBool")));
+    TestEqual(TEXT("Vec2"), Library::GetUsdVec2Attribute(StageActor, TEXT("lamp"), TEXT("customVec2")), FVector2D(1.0, 2.0));
+    TestEqual(TEXT("Vec3"), Library::GetUsdVec3Attribute(StageActor, TEXT("lamp"), TEXT("customVec3")), FVector(1.0, 2.0, 3.0));
+    TestEqual(TEXT("Vec4"), Library::GetUsdVec4Attribute(StageActor, TEXT("lamp"), TEXT("customVec4")), FVector4(1.0, 2.0, 3.0, 4.0));
+    TestEqual(TEXT("Quat"), Library::GetUsdQuatAttribute(StageActor, TEXT("lamp"), TEXT("customQuat")), FQuat(0.5, 0.5, 0.5, 0.5));
+    TestEqual(TEXT("Matrix translation"), Library::GetUsdMatrixAttribute(StageActor, TEXT("lamp"), TEXT("customMatrix")).GetOrigin(), FVector(10.0, 20.0, 30.0));
+    TestEqual(TEXT("String"), Library::GetUsdStringAttribute(StageActor, TEXT("lamp"), TEXT("customString")), FString(TEXT("shot010")));
+    TestEqual(TEXT("Color"), Library::GetUsdColorAttribute(StageActor, TEXT("lamp"), TEXT("customColour")), FLinearColor(0.25f, 0.5f, 0.75f));
+
+    // Paths resolve without the name index, and the same value is read
+    TestEqual(TEXT("Float by path"), Library::GetUsdFloatAttribute(StageActor, TEXT("/World/props/lamp"), TEXT("customFloat")), 1.5f);
+
+    TestEqual(TEXT("Missing attribute"), Library::GetUsdFloatAttribute(StageActor, TEXT("lamp"), TEXT("missing")), 0.0f);
+    TestEqual(TEXT("Missing prim"), Library::GetUsdIntAttribute(StageActor, TEXT("missing"), TEXT("customInt")), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUsdAttributeAnimatedGettersTest, "UsdAttributeTools.AttributeLibrary.AnimatedGetters", UsdAttributeFunctionLibraryTestsImpl::TestFlags)
+
+bool FUsdAttributeAnimatedGettersTest::RunTest(const FString& Parameters)
+{
+    using namespace UsdAttributeFunctionLibraryTestsImpl;
+    using Library = UUsdAttributeFunctionLibraryBPLibrary;
+
+    FScopedTestStage TestStage;
+    const pxr::UsdPrim Prim = TestStage.DefinePrim("/World/anim");
+
+    SetAttribute(Prim, "customFloat", pxr::SdfValueTypeNames->Float, 0.0f, pxr::UsdTimeCode(0.0));
+    SetAttribute(Prim, "customFloat", pxr::SdfValueTypeNames->Float, 10.0f, pxr::UsdTimeCode(10.0));
+    SetAttribute(Prim, "customInt", pxr::SdfValueTypeNames->Int, 1, pxr::UsdTimeCode(0.0));
+    SetAttribute(Prim, "customInt", pxr::SdfValueTypeNames->Int, 3, pxr::UsdTimeCode(10.0));
+    SetAttribute(Prim, "customVec3", pxr::SdfValueTypeNames->Float3, pxr::GfVec3f(0.0f), pxr::UsdTimeCode(0.0));
+    SetAttribute(Prim, "customVec3", pxr::SdfValueTypeNames->Float3, pxr::GfVec3f(2.0f, 4.0f, 6.0f), pxr::UsdTimeCode(10.0));
+    SetAttribute(Prim, "customString", pxr::SdfValueTypeNames->String, std::string("first"), pxr::UsdTimeCode(0.0));
+    SetAttribute(Prim, "customString", pxr::SdfValueTypeNames->String, std::string("second"), pxr::UsdTimeCode(10.0));
+
+    AUsdStageActor* StageActor = TestStage.Open();
+    if (!TestNotNull(TEXT("Stage actor with the in-memory stage"), StageActor))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Float at a sample"), Library::GetUsdAnimatedFloatAttribute(StageActor, TEXT("anim"), TEXT("customFloat"), 10.0), 10.0f);
+    TestEqual(TEXT("Float between samples"), Library::GetUsdAnimatedFloatAttribute(StageActor, TEXT("anim"), TEXT("customFloat"), 2.5), 2.5f);
+    TestEqual(TEXT("Float after the last sample"), Library::GetUsdAnimatedFloatAttribute(StageActor, TEXT("anim"), TEXT("customFloat"), 20.0), 10.0f);
+    TestEqual(TEXT("Vec3 between samples"), Library::GetUsdAnimatedVec3Attribute(StageActor, TEXT("anim"), TEXT("customVec3"), 5.0), FVector(1.0, 2.0, 3.0));
+
+    // Ints and strings aren't interpolated, the earlier sample is held
+    TestEqual(TEXT("Int between samples"), Library::GetUsdAnimatedIntAttribute(StageActor, TEXT("anim"), TEXT("customInt"), 5.0), 1);
+    TestEqual(TEXT("Int at a sample"), Library::GetUsdAnimatedIntAttribute(StageActor, TEXT("anim"), TEXT("customInt"), 10.0), 3);
+    TestEqual(TEXT("String between samples"), Library::GetUsdAnimatedStringAttribute(StageActor, TEXT("anim"), TEXT("customString"), 9.0), FString(TEXT("first")));
+
+    TArray<double> Times;
+    const TArray<float> Values = Library::GetUsdAnimatedFloatAttributeRange(StageActor, TEXT("anim"), TEXT("customFloat"), 0.0, 10.0, 1.0, true, Times);
+    TestEqual(TEXT("Authored sample times"), Times, TArray<double>{ 0.0, 10.0 });
+    TestEqual(TEXT("Authored sample values"), Values, TArray<float>{ 0.0f, 10.0f });
+
+    const TArray<float> SteppedValues = Library::GetUsdAnimatedFloatAttributeRange(StageActor, TEXT("anim"), TEXT("customFloat"), 0.0, 10.0, 5.0, false, Times);
+    TestEqual(TEXT("Stepped sample times"), Times, TArray<double>{ 0.0, 5.0, 10.0 });
+    TestEqual(TEXT("Stepped sample values"), SteppedValues, TArray<float>{ 0.0f, 5.0f, 10.0f });
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUsdAttributeArrayGettersTest, "UsdAttributeTools.AttributeLibrary.ArrayGetters", UsdAttributeFunctionLibraryTestsImpl::TestFlags)
+
+bool FUsdAttributeArrayGettersTest::RunTest(const FString& Parameters)
+{
+    using namespace UsdAttributeFunctionLibraryTestsImpl;
+    using Library = UUsdAttributeFunctionLibraryBPLibrary;
+
+    FScopedTestStage TestStage;
+    const pxr::UsdPrim Prim = TestStage.DefinePrim("/World/points");
+
+    pxr::VtFloatArray Floats{ 1.0f, 2.0f, 3.0f };
+    pxr::VtIntArray Ints{ 4, 5 };
+    pxr::VtVec2fArray Vec2s{ pxr::GfVec2f(1.0f, 2.0f) };
+    pxr::VtVec3fArray Vec3s{ pxr::GfVec3f(1.0f, 2.0f, 3.0f), pxr::GfVec3f(4.0f, 5.0f, 6.0f) };
+
+    SetAttribute(Prim, "customFloatArray", pxr::SdfValueTypeNames->FloatArray, Floats);
+    SetAttribute(Prim, "customIntArray", pxr::SdfValueTypeNames->IntArray, Ints);
+    SetAttribute(Prim, "customVec2Array", pxr::SdfValueTypeNames->Float2Array, Vec2s);
+    SetAttribute(Prim, "customVec3Array", pxr::SdfValueTypeNames->Float3Array, Vec3s);
+    SetAttribute(Prim, "customFloatArray", pxr::SdfValueTypeNames->FloatArray, pxr::VtFloatArray{ 8.0f }, pxr::UsdTimeCode(4.0));
+
+    AUsdStageActor* StageActor = TestStage.Open();
+    if (!TestNotNull(TEXT("Stage actor with the in-memory stage"), StageActor))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Float array"), Library::GetUsdFloatArrayAttribute(StageActor, TEXT("points"), TEXT("customFloatArray")), TArray<float>{ 1.0f, 2.0f, 3.0f });
+    TestEqual(TEXT("Int array"), Library::GetUsdIntArrayAttribute(StageActor, TEXT("points"), TEXT("customIntArray")), TArray<int>{ 4, 5 });
+    TestEqual(TEXT("Vec2 array"), Library::GetUsdVec2ArrayAttribute(StageActor, TEXT("points"), TEXT("customVec2Array")), TArray<FVector2D>{ FVector2D(1.0, 2.0) });
+    TestEqual(TEXT("Vec3 array"), Library::GetUsdVec3ArrayAttribute(StageActor, TEXT("points"), TEXT("customVec3Array"), EUsdVectorConversion::None),
+        TArray<FVector>{ FVector(1.0, 2.0, 3.0), FVector(4.0, 5.0, 6.0) });
+    TestEqual(TEXT("Animated float array"), Library::GetUsdAnimatedFloatArrayAttribute(StageActor, TEXT("points"), TEXT("customFloatArray"), 4.0), TArray<float>{ 8.0f });
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUsdAttributeLookupTest, "UsdAttributeTools.AttributeLibrary.Lookup", UsdAttributeFunctionLibraryTestsImpl::TestFlags)
+
+bool FUsdAttributeLookupTest::RunTest(const FString& Parameters)
+{
+    using namespace UsdAttributeFunctionLibraryTestsImpl;
+    using Library = UUsdAttributeFunctionLibraryBPLibrary;
+
+    FScopedTestStage TestStage;
+    SetAttribute(TestStage.DefinePrim("/World/shot010/camera"), "cameraNumber", pxr::SdfValueTypeNames->Int, 10);
+    SetAttribute(TestStage.DefinePrim("/World/shot020/camera"), "cameraNumber", pxr::SdfValueTypeNames->Int, 20);
+    TestStage.DefinePrim("/World/shot020/set");
+
+    AUsdStageActor* StageActor = TestStage.Open();
+    if (!TestNotNull(TEXT("Stage actor with the in-memory stage"), StageActor))
+    {
+        return false;
+    }
+
+    // Duplicate names resolve in traversal order, so the getters read from the first
+    TestEqual(TEXT("Prims named camera"), Library::FindUsdPrimPaths(StageActor, TEXT("camera")),
+        TArray<FString>{ TEXT("/World/shot010/camera"), TEXT("/World/shot020/camera") });
+    TestEqual(TEXT("First camera"), Library::GetUsdIntAttribute(StageActor, TEXT("camera"), TEXT("cameraNumber")), 10);
+    TestEqual(TEXT("Camera by path"), Library::GetUsdIntAttribute(StageActor, TEXT("/World/shot020/camera"), TEXT("cameraNumber")), 20);
+    TestEqual(TEXT("Camera by pattern"), Library::FindUsdPrimPaths(StageActor, TEXT("/World/**/camera")),
+        TArray<FString>{ TEXT("/World/shot010/camera"), TEXT("/World/shot020/camera") });
+
+    TArray<FString> AttrNames;
+    TestEqual(TEXT("Prims with cameraNumber"), Library::FindUsdPrimsWithAttribute(StageActor, TEXT("cameraNumber"), true, AttrNames),
+        TArray<FString>{ TEXT("/World/shot010/camera"), TEXT("/World/shot020/camera") });
+
+    FUsdAttributeRequest Request;
+    Request.PrimName = TEXT("/World/shot020/camera");
+    Request.AttrName = TEXT("cameraNumber");
+    Request.Type = EUsdAttributeValueType::Int;
+    Request.bAnimated = false;
+
+    TArray<FUsdAttributeRequest> Requests{ Request, Request, Request };
+    Requests[1].PrimName = TEXT("missing");
+    Requests[2].AttrName = TEXT("missing");
+
+    TArray<FUsdAttributeResult> Results;
+    Library::GetUsdAttributesBatch(StageActor, Requests, Results);
+    if (TestEqual(TEXT("Batch results"), Results.Num(), 3))
+    {
+        TestEqual(TEXT("Batch value"), Results[0].IntValue, 20);
+        TestTrue(TEXT("Batch found"), Results[0].Status == EUsdAttributeStatus::Success);
+        TestTrue(TEXT("Batch missing prim"), Results[1].Status == EUsdAttributeStatus::PrimNotFound);
+        TestTrue(TEXT("Batch missing attribute"), Results[2].Status == EUsdAttributeStatus::AttributeNotFound);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && USE_USD_SDK
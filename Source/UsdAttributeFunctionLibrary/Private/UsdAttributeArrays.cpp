@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeArrays.h"
+
+#if USE_USD_SDK
+#include "Async/ParallelFor.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usdGeom/metrics.h"
+#include "pxr/usd/usdGeom/tokens.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdAttributeArraysImpl
+{
+    /** Arrays are converted in chunks of this many elements, so small arrays stay on the calling thread. */
+    constexpr int32 ChunkSize = 16 * 1024;
+
+    /** Unreal's units are centimeters. */
+    constexpr double UnrealMetersPerUnit = 0.01;
+
+    static_assert(sizeof(pxr::GfVec3f) == 3 * sizeof(float), "GfVec3f arrays are read as packed floats");
+    static_assert(sizeof(pxr::GfVec3d) == 3 * sizeof(double), "GfVec3d arrays are read as packed doubles");
+    static_assert(sizeof(FVector) == 3 * sizeof(double), "FVector arrays are written as packed doubles");
+
+    /**
+     * @brief Calls Kernel(Start, End) over consecutive chunks of [0, Num), in parallel when there is more than one chunk.
+     */
+    template <typename KernelType>
+    void ForEachChunk(int32 Num, const KernelType& Kernel)
+    {
+        const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+        ParallelFor(NumChunks, [Num, &Kernel](int32 Chunk)
+        {
+            const int32 Start = Chunk * ChunkSize;
+            Kernel(Start, FMath::Min(Start + ChunkSize, Num));
+        }, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    }
+}
+
+UsdAttributeArrays::FUsdAxisConversion UsdAttributeArrays::FUsdAxisConversion::FromStage(const UE::FUsdStage& Stage, EUsdVectorConversion Conversion)
+{
+    FUsdAxisConversion Result;
+    if (Conversion == EUsdVectorConversion::None || !Stage)
+    {
+        return Result;
+    }
+
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+
+    if (Conversion == EUsdVectorConversion::Position)
+    {
+        const double MetersPerUnit = pxr::UsdGeomGetStageMetersPerUnit(UsdStage);
+        if (!FMath::IsNearlyEqual(MetersPerUnit, UsdAttributeArraysImpl::UnrealMetersPerUnit))
+        {
+            Result.Scale = FVector(MetersPerUnit / UsdAttributeArraysImpl::UnrealMetersPerUnit);
+        }
+    }
+
+    // Swapping Y and Z changes handedness on its own, Z up stages flip Y instead
+    Result.bSwapYZ = pxr::UsdGeomGetStageUpAxis(UsdStage) != pxr::UsdGeomTokens->z;
+    if (!Result.bSwapYZ)
+    {
+        Result.Scale.Y = -Result.Scale.Y;
+    }
+
+    return Result;
+}
+
+void UsdAttributeArrays::ConvertVectors(TArrayView<const pxr::GfVec3f> Values, const FUsdAxisConversion& Conversion, TArray<FVector>& OutValues)
+{
+    OutValues.SetNumUninitialized(Values.Num());
+
+    const float* Source = reinterpret_cast<const float*>(Values.GetData());
+    double* Destination = reinterpret_cast<double*>(OutValues.GetData());
+    const VectorRegister4Double Scale = MakeVectorRegisterDouble(Conversion.Scale.X, Conversion.Scale.Y, Conversion.Scale.Z, 0.0);
+
+    // Each element is widened to double before scaling, so large metersPerUnit remaps keep their precision
+    if (Conversion.bSwapYZ)
+    {
+        UsdAttributeArraysImpl::ForEachChunk(Values.Num(), [Source, Destination, &Scale](int32 Start, int32 End)
+        {
+            for (int32 Index = Start; Index < End; ++Index)
+            {
+                const VectorRegister4Float Value = VectorSwizzle(VectorLoadFloat3(Source + Index * 3), 0, 2, 1, 3);
+                VectorStoreDouble3(VectorMultiply(VectorRegister4Double(Value), Scale), Destination + Index * 3);
+            }
+        });
+    }
+    else
+    {
+        UsdAttributeArraysImpl::ForEachChunk(Values.Num(), [Source, Destination, &Scale](int32 Start, int32 End)
+        {
+            for (int32 Index = Start; Index < End; ++Index)
+            {
+                const VectorRegister4Float Value = VectorLoadFloat3(Source + Index * 3);
+                VectorStoreDouble3(VectorMultiply(VectorRegister4Double(Value), Scale), Destination + Index * 3);
+            }
+        });
+    }
+}
+
+void UsdAttributeArrays::ConvertVectors(TArrayView<const pxr::GfVec3d> Values, const FUsdAxisConversion& Conversion, TArray<FVector>& OutValues)
+{
+    OutValues.SetNumUninitialized(Values.Num());
+
+    const double* Source = reinterpret_cast<const double*>(Values.GetData());
+    double* Destination = reinterpret_cast<double*>(OutValues.GetData());
+    const VectorRegister4Double Scale = MakeVectorRegisterDouble(Conversion.Scale.X, Conversion.Scale.Y, Conversion.Scale.Z, 0.0);
+    const int32 SwappedY = Conversion.bSwapYZ ? 2 : 1;
+    const int32 SwappedZ = Conversion.bSwapYZ ? 1 : 2;
+
+    UsdAttributeArraysImpl::ForEachChunk(Values.Num(), [Source, Destination, &Scale, SwappedY, SwappedZ](int32 Start, int32 End)
+    {
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            const double* Value = Source + Index * 3;
+            const VectorRegister4Double Swapped = MakeVectorRegisterDouble(Value[0], Value[SwappedY], Value[SwappedZ], 0.0);
+            VectorStoreDouble3(VectorMultiply(Swapped, Scale), Destination + Index * 3);
+        }
+    });
+}
+
+void UsdAttributeArrays::ConvertVectors(TArrayView<const pxr::GfVec2f> Values, TArray<FVector2D>& OutValues)
+{
+    OutValues.SetNumUninitialized(Values.Num());
+
+    const pxr::GfVec2f* Source = Values.GetData();
+    FVector2D* Destination = OutValues.GetData();
+    UsdAttributeArraysImpl::ForEachChunk(Values.Num(), [Source, Destination](int32 Start, int32 End)
+    {
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            Destination[Index] = FVector2D(Source[Index][0], Source[Index][1]);
+        }
+    });
+}
+#endif
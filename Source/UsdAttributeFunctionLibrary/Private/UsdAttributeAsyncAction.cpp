@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeAsyncAction.h"
+#include "UsdAttributeFunctionLibraryBPLibrary.h"
+
+#if USE_USD_SDK
+#include "USDStageActor.h"
+#endif
+
+UUsdAttributeAsyncAction* UUsdAttributeAsyncAction::GetUsdAttributeAsync(AUsdStageActor* StageActor, FString PrimName, FString AttrName,
+    EUsdAttributeValueType Type, bool bAnimated, double TimeSample)
+{
+    UUsdAttributeAsyncAction* Action = NewObject<UUsdAttributeAsyncAction>();
+    Action->StageActor = StageActor;
+    Action->Request.PrimName = MoveTemp(PrimName);
+    Action->Request.AttrName = MoveTemp(AttrName);
+    Action->Request.Type = Type;
+    Action->Request.bAnimated = bAnimated;
+    Action->Request.TimeSample = TimeSample;
+    Action->RegisterWithGameInstance(StageActor);
+    return Action;
+}
+
+void UUsdAttributeAsyncAction::Activate()
+{
+    // RegisterWithGameInstance does nothing without a game instance, e.g. in editor worlds, so root the
+    // action until the read completes rather than rely on it
+    AddToRoot();
+
+    UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributesBatchAsync(StageActor.Get(), { Request })
+        .Then([this](TFuture<TArray<FUsdAttributeResult>> Future)
+        {
+            // Fulfilled on the game thread
+            const FUsdAttributeResult& Result = Future.Get()[0];
+            if (Result.Status == EUsdAttributeStatus::Success)
+            {
+                OnSuccess.Broadcast(Result);
+            }
+            else
+            {
+                OnFailure.Broadcast(Result);
+            }
+
+            RemoveFromRoot();
+            SetReadyToDestroy();
+        });
+}
+
+UUsdAttributeBatchAsyncAction* UUsdAttributeBatchAsyncAction::GetUsdAttributesBatchAsync(AUsdStageActor* StageActor, const TArray<FUsdAttributeRequest>& Requests)
+{
+    UUsdAttributeBatchAsyncAction* Action = NewObject<UUsdAttributeBatchAsyncAction>();
+    Action->StageActor = StageActor;
+    Action->Requests = Requests;
+    Action->RegisterWithGameInstance(StageActor);
+    return Action;
+}
+
+void UUsdAttributeBatchAsyncAction::Activate()
+{
+    // Rooted until the read completes, as for UUsdAttributeAsyncAction
+    AddToRoot();
+
+    UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributesBatchAsync(StageActor.Get(), MoveTemp(Requests))
+        .Then([this](TFuture<TArray<FUsdAttributeResult>> Future)
+        {
+            OnCompleted.Broadcast(Future.Get());
+
+            RemoveFromRoot();
+            SetReadyToDestroy();
+        });
+}
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeBindingComponent.h"
+#include "UsdAttributeBindingSubsystem.h"
+
+#include "Engine/World.h"
+#include "USDStageActor.h"
+
+UUsdAttributeBindingComponent::UUsdAttributeBindingComponent()
+{
+    // Evaluated by the binding subsystem rather than ticking per component
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UUsdAttributeBindingComponent::SetStageActor(AUsdStageActor* InStageActor)
+{
+    StageActor = InStageActor;
+    RefreshBindings();
+}
+
+void UUsdAttributeBindingComponent::SetBindings(const TArray<FUsdAttributeBinding>& InBindings)
+{
+    Bindings = InBindings;
+    RefreshBindings();
+}
+
+void UUsdAttributeBindingComponent::RefreshBindings()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UUsdAttributeBindingSubsystem* Subsystem = World->GetSubsystem<UUsdAttributeBindingSubsystem>())
+        {
+            Subsystem->MarkBindingsDirty();
+        }
+    }
+}
+
+void UUsdAttributeBindingComponent::OnRegister()
+{
+    Super::OnRegister();
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UUsdAttributeBindingSubsystem* Subsystem = World->GetSubsystem<UUsdAttributeBindingSubsystem>())
+        {
+            Subsystem->RegisterComponent(this);
+        }
+    }
+}
+
+void UUsdAttributeBindingComponent::OnUnregister()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UUsdAttributeBindingSubsystem* Subsystem = World->GetSubsystem<UUsdAttributeBindingSubsystem>())
+        {
+            Subsystem->UnregisterComponent(this);
+        }
+    }
+
+    Super::OnUnregister();
+}
+
+#if WITH_EDITOR
+void UUsdAttributeBindingComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    RefreshBindings();
+}
+#endif
@@ -0,0 +1,626 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeBindingSubsystem.h"
+#include "UsdAttributeBindingComponent.h"
+#include "UsdAttributeFunctionLibrary.h"
+#include "UsdAttributeFunctionLibraryBPLibrary.h"
+#include "UsdAttributeStageCache.h"
+#include "UsdAttributeStats.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UnrealType.h"
+#include "USDStageActor.h"
+
+namespace UsdAttributeBindingImpl
+{
+    /** Groups are only read in parallel when there are at least this many, as smaller batches cost less than the task dispatch. */
+    constexpr int32 MinParallelGroups = 4;
+
+    TAutoConsoleVariable<bool> CVarParallel(
+        TEXT("UsdAttributes.Bindings.Parallel"),
+        true,
+        TEXT("Whether the attribute binding groups are read from Usd in parallel"));
+
+    /**
+     * @brief Finds the attribute value type that can be written to a property.
+     *
+     * @param Property The property a binding writes.
+     * @param OutType The type to read the attribute as.
+     * @return False if the property's type isn't supported.
+     */
+    bool GetPropertyValueType(const FProperty* Property, EUsdAttributeValueType& OutType)
+    {
+        if (Property->ArrayDim != 1)
+        {
+            return false;
+        }
+
+        if (Property->IsA<FBoolProperty>())
+        {
+            OutType = EUsdAttributeValueType::Bool;
+            return true;
+        }
+        if (Property->IsA<FFloatProperty>())
+        {
+            OutType = EUsdAttributeValueType::Float;
+            return true;
+        }
+        if (Property->IsA<FDoubleProperty>())
+        {
+            OutType = EUsdAttributeValueType::Double;
+            return true;
+        }
+        if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+        {
+            if (NumericProperty->IsInteger() && !NumericProperty->IsEnum())
+            {
+                OutType = EUsdAttributeValueType::Int;
+                return true;
+            }
+            return false;
+        }
+        if (Property->IsA<FStrProperty>())
+        {
+            OutType = EUsdAttributeValueType::String;
+            return true;
+        }
+
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        if (!StructProperty)
+        {
+            return false;
+        }
+
+        const FName StructName = StructProperty->Struct->GetFName();
+        if (StructName == NAME_Vector || StructName == NAME_Rotator)
+        {
+            OutType = EUsdAttributeValueType::Vec3;
+        }
+        else if (StructName == NAME_Vector2D)
+        {
+            OutType = EUsdAttributeValueType::Vec2;
+        }
+        else if (StructName == NAME_Vector4)
+        {
+            OutType = EUsdAttributeValueType::Vec4;
+        }
+        else if (StructName == NAME_Quat)
+        {
+            OutType = EUsdAttributeValueType::Quat;
+        }
+        else if (StructName == NAME_Matrix)
+        {
+            OutType = EUsdAttributeValueType::Matrix;
+        }
+        else if (StructName == NAME_LinearColor)
+        {
+            OutType = EUsdAttributeValueType::Color;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Resolves a property path from an actor, following object properties and descending into structs.
+     *
+     * @param Owner The actor owning the binding component.
+     * @param PropertyPath The dot separated property path, whose first name may be a component name.
+     * @param OutTarget Receives the last object along the path and the property chain from it.
+     * @return True if the path leads to a property.
+     */
+    bool ResolvePropertyPath(AActor& Owner, const FString& PropertyPath, FUsdAttributeBindingTarget& OutTarget)
+    {
+        TArray<FString> Names;
+        PropertyPath.ParseIntoArray(Names, TEXT("."));
+        if (Names.IsEmpty())
+        {
+            return false;
+        }
+
+        UObject* Object = &Owner;
+        int32 FirstProperty = 0;
+
+        // Components added in the editor or by construction scripts aren't always reachable through a property
+        TInlineComponentArray<UActorComponent*> Components(&Owner);
+        for (UActorComponent* Component : Components)
+        {
+            if (Component->GetName() == Names[0])
+            {
+                Object = Component;
+                FirstProperty = 1;
+                break;
+            }
+        }
+
+        const UStruct* Struct = Object->GetClass();
+        void* Container = Object;
+        OutTarget.PropertyChain.Reset();
+
+        for (int32 Index = FirstProperty; Index < Names.Num(); ++Index)
+        {
+            FProperty* Property = FindFProperty<FProperty>(Struct, *Names[Index]);
+            if (!Property)
+            {
+                return false;
+            }
+
+            OutTarget.PropertyChain.Add(Property);
+            if (Index == Names.Num() - 1)
+            {
+                break;
+            }
+
+            if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+            {
+                // The chain restarts from the referenced object, which is resolved now rather than on every frame
+                UObject* Next = ObjectProperty->GetObjectPropertyValue_InContainer(Container);
+                if (!Next)
+                {
+                    return false;
+                }
+                Object = Next;
+                Struct = Next->GetClass();
+                Container = Next;
+                OutTarget.PropertyChain.Reset();
+            }
+            else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+            {
+                Struct = StructProperty->Struct;
+                Container = StructProperty->ContainerPtrToValuePtr<void>(Container);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if (OutTarget.PropertyChain.IsEmpty())
+        {
+            return false;
+        }
+
+        OutTarget.Object = Object;
+        if (Object->IsA<USceneComponent>())
+        {
+            const FName RootName = OutTarget.PropertyChain[0]->GetFName();
+            OutTarget.bIsRelativeTransform = RootName == USceneComponent::GetRelativeLocationPropertyName()
+                || RootName == USceneComponent::GetRelativeRotationPropertyName()
+                || RootName == USceneComponent::GetRelativeScale3DPropertyName();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Resolves where a binding writes and the type its attribute should be read as.
+     *
+     * @param Owner The actor owning the binding component.
+     * @param Binding The binding.
+     * @param OutTarget The resolved target.
+     * @param OutType The type to read the attribute as.
+     * @return False if the property, component or material slot couldn't be found.
+     */
+    bool ResolveBinding(AActor& Owner, const FUsdAttributeBinding& Binding, FUsdAttributeBindingTarget& OutTarget, EUsdAttributeValueType& OutType)
+    {
+        OutTarget.Kind = Binding.Target;
+
+        if (Binding.Target == EUsdAttributeBindingTarget::Property)
+        {
+            return ResolvePropertyPath(Owner, Binding.PropertyPath, OutTarget) && GetPropertyValueType(OutTarget.PropertyChain.Last(), OutType);
+        }
+
+        UPrimitiveComponent* PrimitiveComponent = nullptr;
+        TInlineComponentArray<UPrimitiveComponent*> Components(&Owner);
+        for (UPrimitiveComponent* Component : Components)
+        {
+            if (Binding.ComponentName.IsNone() || Component->GetFName() == Binding.ComponentName)
+            {
+                PrimitiveComponent = Component;
+                break;
+            }
+        }
+
+        if (!PrimitiveComponent || !PrimitiveComponent->IsValidMaterialIndex(Binding.MaterialIndex))
+        {
+            return false;
+        }
+
+        // Returns the slot's dynamic instance if it already has one, so compiling again doesn't replace it
+        UMaterialInstanceDynamic* Material = PrimitiveComponent->CreateAndSetMaterialInstanceDynamic(Binding.MaterialIndex);
+        if (!Material)
+        {
+            return false;
+        }
+
+        OutTarget.Object = PrimitiveComponent;
+        OutTarget.Material = Material;
+        OutTarget.ParameterName = Binding.ParameterName;
+        OutType = Binding.Target == EUsdAttributeBindingTarget::ScalarMaterialParameter ? EUsdAttributeValueType::Float : EUsdAttributeValueType::Color;
+        return true;
+    }
+
+    /** @return True if Value differed from NewValue and was overwritten. */
+    template <typename T>
+    bool WriteIfChanged(void* Value, const T& NewValue)
+    {
+        T& Current = *static_cast<T*>(Value);
+        if (Current == NewValue)
+        {
+            return false;
+        }
+        Current = NewValue;
+        return true;
+    }
+
+    /**
+     * @brief Writes a value read for a binding to its property.
+     *
+     * @return True if the property's value changed.
+     */
+    bool WriteProperty(const FUsdAttributeBindingTarget& Target, UObject& Object, const FUsdAttributeResult& Result)
+    {
+        void* Container = &Object;
+        for (int32 Index = 0; Index < Target.PropertyChain.Num() - 1; ++Index)
+        {
+            Container = Target.PropertyChain[Index]->ContainerPtrToValuePtr<void>(Container);
+        }
+
+        const FProperty* Property = Target.PropertyChain.Last();
+        void* Value = Property->ContainerPtrToValuePtr<void>(Container);
+
+        if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+        {
+            if (BoolProperty->GetPropertyValue(Value) == Result.BoolValue)
+            {
+                return false;
+            }
+            BoolProperty->SetPropertyValue(Value, Result.BoolValue);
+            return true;
+        }
+        if (Property->IsA<FFloatProperty>())
+        {
+            return WriteIfChanged(Value, Result.FloatValue);
+        }
+        if (Property->IsA<FDoubleProperty>())
+        {
+            return WriteIfChanged(Value, Result.DoubleValue);
+        }
+        if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+        {
+            if (NumericProperty->GetSignedIntPropertyValue(Value) == Result.IntValue)
+            {
+                return false;
+            }
+            NumericProperty->SetIntPropertyValue(Value, static_cast<int64>(Result.IntValue));
+            return true;
+        }
+        if (Property->IsA<FStrProperty>())
+        {
+            return WriteIfChanged(Value, Result.StringValue);
+        }
+
+        const FName StructName = CastFieldChecked<const FStructProperty>(Property)->Struct->GetFName();
+        if (StructName == NAME_Vector)
+        {
+            return WriteIfChanged(Value, Result.VectorValue);
+        }
+        if (StructName == NAME_Rotator)
+        {
+            return WriteIfChanged(Value, UUsdAttributeFunctionLibraryBPLibrary::ConvertToUnrealRotator(Result.VectorValue));
+        }
+        if (StructName == NAME_Vector2D)
+        {
+            return WriteIfChanged(Value, Result.Vector2DValue);
+        }
+        if (StructName == NAME_Vector4)
+        {
+            return WriteIfChanged(Value, Result.Vector4Value);
+        }
+        if (StructName == NAME_Quat)
+        {
+            return WriteIfChanged(Value, Result.QuatValue);
+        }
+        if (StructName == NAME_Matrix)
+        {
+            return WriteIfChanged(Value, Result.MatrixValue);
+        }
+        return WriteIfChanged(Value, Result.ColorValue);
+    }
+
+#if USE_USD_SDK
+    /** @return The number of values a baked curve or sampler holds for the type, or 0 if it can't be read from one. */
+    int32 GetNumComponents(EUsdAttributeValueType Type)
+    {
+        switch (Type)
+        {
+        case EUsdAttributeValueType::Float:
+        case EUsdAttributeValueType::Double:
+        case EUsdAttributeValueType::Int:
+            return 1;
+        case EUsdAttributeValueType::Vec3:
+        case EUsdAttributeValueType::Color:
+            return 3;
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Reads a binding from its baked curve or sampler, the sources the GetUsdAnimated...Attribute functions read first.
+     *
+     * Game thread only, as the curves and samplers aren't guarded by the cache's lock.
+     *
+     * @return False if neither is set up for the attribute, leaving it to the batch read.
+     */
+    bool ReadBakedOrSampled(FUsdAttributeStageCache& StageCache, const FUsdAttributeRequest& Request, FUsdAttributeResult& OutResult)
+    {
+        const int32 NumComponents = GetNumComponents(Request.Type);
+        if (NumComponents == 0)
+        {
+            return false;
+        }
+
+        double Components[3] = {};
+        bool bRead = UUsdAttributeFunctionLibraryBPLibrary::EvaluateBakedUsdAttribute(StageCache, Request.PrimName, Request.AttrName, Request.TimeSample, Components, NumComponents);
+        if (!bRead && StageCache.HasInterpolations())
+        {
+            // Only the queries the batch read has already resolved are used, so prims are never searched for on the game thread
+            const pxr::UsdAttributeQuery Query = StageCache.FindAttributeQuery(Request.PrimName, Request.AttrName);
+            bRead = Query.IsValid() && UUsdAttributeFunctionLibraryBPLibrary::EvaluateSampledUsdAttribute(StageCache, Query, Request.PrimName, Request.AttrName,
+                Request.TimeSample, Components, NumComponents);
+        }
+        if (!bRead)
+        {
+            return false;
+        }
+
+        switch (Request.Type)
+        {
+        case EUsdAttributeValueType::Float:  OutResult.FloatValue = static_cast<float>(Components[0]); break;
+        case EUsdAttributeValueType::Double: OutResult.DoubleValue = Components[0]; break;
+        case EUsdAttributeValueType::Int:    OutResult.IntValue = static_cast<int32>(Components[0]); break;
+        case EUsdAttributeValueType::Vec3:   OutResult.VectorValue = FVector(Components[0], Components[1], Components[2]); break;
+        default:                             OutResult.ColorValue = FLinearColor(static_cast<float>(Components[0]), static_cast<float>(Components[1]), static_cast<float>(Components[2])); break;
+        }
+        OutResult.Status = EUsdAttributeStatus::Success;
+        return true;
+    }
+#endif
+}
+
+void UUsdAttributeBindingSubsystem::RegisterComponent(UUsdAttributeBindingComponent* Component)
+{
+    Components.AddUnique(Component);
+    bBindingsDirty = true;
+}
+
+void UUsdAttributeBindingSubsystem::UnregisterComponent(UUsdAttributeBindingComponent* Component)
+{
+    Components.RemoveSingleSwap(Component);
+    bBindingsDirty = true;
+}
+
+void UUsdAttributeBindingSubsystem::CompileBindings()
+{
+    using namespace UsdAttributeBindingImpl;
+
+    bBindingsDirty = false;
+    Groups.Reset();
+    Components.RemoveAllSwap([](const TWeakObjectPtr<UUsdAttributeBindingComponent>& Component) { return !Component.IsValid(); });
+
+    // Prim names are only grouped here, the batch read still compares them case sensitively
+    TMap<TObjectKey<AUsdStageActor>, TMap<FString, int32>> GroupIndices;
+
+    for (const TWeakObjectPtr<UUsdAttributeBindingComponent>& WeakComponent : Components)
+    {
+        UUsdAttributeBindingComponent* Component = WeakComponent.Get();
+        AActor* Owner = Component->GetOwner();
+        AUsdStageActor* StageActor = Component->StageActor;
+        if (!Owner || !StageActor)
+        {
+            continue;
+        }
+
+        TMap<FString, int32>& StageGroups = GroupIndices.FindOrAdd(TObjectKey<AUsdStageActor>(StageActor));
+        for (const FUsdAttributeBinding& Binding : Component->Bindings)
+        {
+            FUsdAttributeBindingTarget Target;
+            FUsdAttributeRequest Request;
+            if (!ResolveBinding(*Owner, Binding, Target, Request.Type))
+            {
+                UE_LOG(LogUsdAttributes, Warning, TEXT("Unable to bind Attribute: %s on Prim: %s to %s on %s"), *Binding.AttrName, *Binding.PrimName,
+                    Binding.Target == EUsdAttributeBindingTarget::Property ? *Binding.PropertyPath : *Binding.ParameterName.ToString(), *Owner->GetName());
+                continue;
+            }
+
+            Request.PrimName = Binding.PrimName;
+            Request.AttrName = Binding.AttrName;
+            Request.bAnimated = true;
+
+            int32& GroupIndex = StageGroups.FindOrAdd(Binding.PrimName, INDEX_NONE);
+            if (GroupIndex == INDEX_NONE)
+            {
+                GroupIndex = Groups.AddDefaulted();
+                Groups[GroupIndex].StageActor = StageActor;
+            }
+
+            FUsdAttributeBindingGroup& Group = Groups[GroupIndex];
+            Group.Requests.Add(MoveTemp(Request));
+            Group.Targets.Add(MoveTemp(Target));
+        }
+    }
+
+    for (FUsdAttributeBindingGroup& Group : Groups)
+    {
+        Group.Results.SetNum(Group.Requests.Num());
+    }
+}
+
+void UUsdAttributeBindingSubsystem::EvaluateBindings()
+{
+    using namespace UsdAttributeBindingImpl;
+
+    USD_ATTRIBUTE_SCOPE_CALL(Bindings);
+
+    if (bBindingsDirty)
+    {
+        CompileBindings();
+    }
+
+    if (Groups.IsEmpty())
+    {
+        return;
+    }
+
+#if USE_USD_SDK
+    // Stage caches are found on the game thread, once per stage actor
+    TArray<TSharedPtr<FUsdAttributeStageCache>> Caches;
+    Caches.SetNum(Groups.Num());
+    TMap<AUsdStageActor*, TSharedPtr<FUsdAttributeStageCache>> StageCaches;
+
+    for (int32 Index = 0; Index < Groups.Num(); ++Index)
+    {
+        FUsdAttributeBindingGroup& Group = Groups[Index];
+        AUsdStageActor* StageActor = Group.StageActor.Get();
+        if (!StageActor)
+        {
+            continue;
+        }
+
+        if (TSharedPtr<FUsdAttributeStageCache>* Found = StageCaches.Find(StageActor))
+        {
+            Caches[Index] = *Found;
+        }
+        else
+        {
+            Caches[Index] = StageCaches.Add(StageActor, FUsdAttributeStageCache::FindOrCreate(StageActor));
+        }
+
+        const double Time = StageActor->GetTime();
+        for (FUsdAttributeRequest& Request : Group.Requests)
+        {
+            Request.TimeSample = Time;
+        }
+
+        // Baked curves and samplers are game thread only, so read the bindings they cover here and batch the rest
+        FUsdAttributeStageCache* StageCache = Caches[Index].Get();
+        Group.BatchedRequests.Init(true, Group.Requests.Num());
+        if (StageCache && (StageCache->IsUsingBakedCurves() || StageCache->HasInterpolations()))
+        {
+            for (int32 RequestIndex = 0; RequestIndex < Group.Requests.Num(); ++RequestIndex)
+            {
+                if (ReadBakedOrSampled(*StageCache, Group.Requests[RequestIndex], Group.Results[RequestIndex]))
+                {
+                    Group.BatchedRequests[RequestIndex] = false;
+                }
+            }
+        }
+    }
+
+    // Groups only share the stage caches, which are safe to read from worker tasks
+    const bool bParallel = CVarParallel.GetValueOnGameThread() && Groups.Num() >= MinParallelGroups;
+    ParallelFor(Groups.Num(), [this, &Caches](int32 Index)
+    {
+        if (Caches[Index])
+        {
+            FUsdAttributeBindingGroup& Group = Groups[Index];
+            UUsdAttributeFunctionLibraryBPLibrary::ReadUsdAttributesBatch(*Caches[Index], Group.Requests, Group.Results, &Group.BatchedRequests);
+        }
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    // Components are only refreshed once however many of their properties changed
+    TSet<UActorComponent*> ChangedComponents;
+    TSet<USceneComponent*> MovedComponents;
+
+    for (int32 Index = 0; Index < Groups.Num(); ++Index)
+    {
+        if (!Caches[Index])
+        {
+            continue;
+        }
+
+        FUsdAttributeBindingGroup& Group = Groups[Index];
+        for (int32 BindingIndex = 0; BindingIndex < Group.Targets.Num(); ++BindingIndex)
+        {
+            const FUsdAttributeResult& Result = Group.Results[BindingIndex];
+            FUsdAttributeBindingTarget& Target = Group.Targets[BindingIndex];
+            if (Result.Status != EUsdAttributeStatus::Success)
+            {
+                continue;
+            }
+
+            if (Target.Kind == EUsdAttributeBindingTarget::Property)
+            {
+                UObject* Object = Target.Object.Get();
+                if (!Object || !WriteProperty(Target, *Object, Result))
+                {
+                    continue;
+                }
+
+                if (Target.bIsRelativeTransform)
+                {
+                    MovedComponents.Add(CastChecked<USceneComponent>(Object));
+                }
+                else if (UActorComponent* Component = Cast<UActorComponent>(Object))
+                {
+                    ChangedComponents.Add(Component);
+                }
+            }
+            else if (UMaterialInstanceDynamic* Material = Target.Material.Get())
+            {
+                // Each set is sent to the render thread, so skip values that haven't changed since the last frame
+                const bool bScalar = Target.Kind == EUsdAttributeBindingTarget::ScalarMaterialParameter;
+                const FLinearColor Value = bScalar ? FLinearColor(Result.FloatValue, 0.0f, 0.0f, 0.0f) : Result.ColorValue;
+                if (Target.LastParameterValue.IsSet() && Target.LastParameterValue.GetValue() == Value)
+                {
+                    continue;
+                }
+                Target.LastParameterValue = Value;
+
+                if (bScalar)
+                {
+                    Material->SetScalarParameterValue(Target.ParameterName, Result.FloatValue);
+                }
+                else
+                {
+                    Material->SetVectorParameterValue(Target.ParameterName, Result.ColorValue);
+                }
+            }
+        }
+    }
+
+    // Properties are written directly rather than through their setters, so propagate the changes the setters would have
+    for (USceneComponent* Component : MovedComponents)
+    {
+        Component->UpdateComponentToWorld();
+    }
+    for (UActorComponent* Component : ChangedComponents)
+    {
+        Component->MarkRenderStateDirty();
+    }
+#endif
+}
+
+void UUsdAttributeBindingSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    EvaluateBindings();
+}
+
+bool UUsdAttributeBindingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UUsdAttributeBindingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UUsdAttributeBindingSubsystem, STATGROUP_Tickables);
+}
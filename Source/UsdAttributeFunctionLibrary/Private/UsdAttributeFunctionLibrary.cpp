@@ -1,10 +1,14 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "UsdAttributeFunctionLibrary.h"
+#include "UsdAttributeStageCache.h"
+#include "UsdAttributeSubscriptions.h"
 
 
 #define LOCTEXT_NAMESPACE "FUsdAttributeFunctionLibraryModule"
 
+DEFINE_LOG_CATEGORY(LogUsdAttributes);
+
 void FUsdAttributeFunctionLibraryModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -15,7 +19,10 @@ void FUsdAttributeFunctionLibraryModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
-	
+#if USE_USD_SDK
+	FUsdAttributeSubscriptions::Get().Reset();
+	FUsdAttributeStageCache::ResetAll();
+#endif
 }
 
 
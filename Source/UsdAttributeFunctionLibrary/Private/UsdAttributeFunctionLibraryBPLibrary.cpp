@@ -2,6 +2,12 @@
 
 #include "UsdAttributeFunctionLibraryBPLibrary.h"
 #include "UsdAttributeFunctionLibrary.h"
+#include "UsdAttributeStageCache.h"
+#include "UsdAttributeArrays.h"
+#include "UsdAttributeSubscriptions.h"
+#include "UsdAttributeTypeRegistry.h"
+#include "Algo/StableSort.h"
+#include "Async/Async.h"
 
 #if USE_USD_SDK
 #include "USDIncludesStart.h"
@@ -16,6 +22,8 @@
 #include "pxr/base/gf/vec3f.h"
 #include "pxr/base/gf/vec3d.h"
 #include "pxr/base/gf/vec3i.h"
+#include "pxr/base/gf/interval.h"
+#include "pxr/usd/usd/attributeQuery.h"
 #include "USDIncludesEnd.h"
 #endif
 
@@ -26,10 +34,34 @@ UUsdAttributeFunctionLibraryBPLibrary::UUsdAttributeFunctionLibraryBPLibrary(con
 }
 
 #if USE_USD_SDK
+namespace UsdAttributeQueryImpl
+{
+    /**
+     * @brief Resolves the value of an attribute through a query that has already been found.
+     *
+     * @param Query The attribute's query.
+     * @param AttrName The name of the attribute, for logging.
+     * @param TimeSample The time sample to read, or unset to read the default value.
+     * @param OutValue The resolved attribute value.
+     * @return True if a value was resolved.
+     */
+    bool GetQueryValue(const pxr::UsdAttributeQuery& Query, const FString& AttrName, TOptional<double> TimeSample, UE::FVtValue& OutValue)
+    {
+        const pxr::UsdTimeCode TimeCode = TimeSample.IsSet() ? pxr::UsdTimeCode(TimeSample.GetValue()) : pxr::UsdTimeCode::Default();
+        if (!Query.Get(&OutValue.GetUsdValue(), TimeCode))
+        {
+            UE_LOG(LogUsdAttributes, Warning, TEXT("Failed to get value for Attribute: %s"), *AttrName);
+            return false;
+        }
+
+        return true;
+    }
+}
+
 /**
  * @brief Retrieves the UE:FUsdAttribute object from a specified stage actor, prim name, and attribute name.
  * 
- * Searches through the Usd stage for the given prim and attribute names, and returns the 
+ * Resolves the given prim name, path or pattern through the stage cache, and returns the 
  * corresponding Usd attribute
  * 
  * @param StageActor The current UsdStageActor.
@@ -42,7 +74,7 @@ UE::FUsdAttribute UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeInternal
     // Check if the StageActor is valid
     if (!StageActor)
     {
-        UE_LOG(LogTemp, Error, TEXT("StageActor is null"));
+        UE_LOG(LogUsdAttributes, Error, TEXT("StageActor is null"));
         return UE::FUsdAttribute();
     }
     
@@ -50,33 +82,18 @@ UE::FUsdAttribute UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeInternal
     UE::FUsdStage StageBase = StageActor->GetUsdStage();
     if (!StageBase)
     {
-        UE_LOG(LogTemp, Warning, TEXT("No Usd Stage found"));
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found"));
         return UE::FUsdAttribute();
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Found stage"));
-
-    UE::FSdfPath PrimPath;
-    UE::FUsdPrim root = StageBase.GetPseudoRoot();
-    if (!root)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Failed to get PseudoRoot"));
-        return UE::FUsdAttribute();
-    }
-
-    // Retrieve the path of the specified prim
-    GetSdfPathWithName(root, PrimName, PrimPath);
-    if (PrimPath.IsEmpty())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("PrimPath is empty for PrimName: %s"), *PrimName);
-        return UE::FUsdAttribute();
-    }
+    UE_LOG(LogUsdAttributes, VeryVerbose, TEXT("Found stage"));
 
-    // Get the prim at the specified path
-    UE::FUsdPrim CurrentPrim = StageBase.GetPrimAtPath(PrimPath);
+    // Resolve the prim through the stage cache: names use the name index, paths skip the search entirely
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    UE::FUsdPrim CurrentPrim = StageCache ? UE::FUsdPrim(StageCache->FindPrim(PrimName)) : UE::FUsdPrim();
     if (!CurrentPrim)
     {
-        UE_LOG(LogTemp, Warning, TEXT("No Prim found at path: %s"), *PrimPath.GetString());
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Prim found for PrimName: %s"), *PrimName);
         return UE::FUsdAttribute();
     }
 
@@ -85,77 +102,206 @@ UE::FUsdAttribute UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeInternal
     UE::FUsdAttribute Attr = CurrentPrim.GetAttribute(AttrNameTChar);
     if (!Attr)
     {
-        UE_LOG(LogTemp, Warning, TEXT("No Attribute found with name: %s"), AttrNameTChar);
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Attribute found with name: %s"), AttrNameTChar);
         return UE::FUsdAttribute();
     }
 
     return Attr;
 }
 
-#endif
+/**
+ * @brief Resolves the value of a Usd attribute through the stage's attribute query cache.
+ * 
+ * The first read of an attribute finds the prim and attribute and caches a pxr::UsdAttributeQuery
+ * for it, so subsequent reads at any time sample only fetch the value.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param PrimName The name of the USD prim to search for.
+ * @param AttrName The name of the attribute to retrieve from the prim.
+ * @param TimeSample The time sample to read, or unset to read the default value.
+ * @param OutValue The resolved attribute value.
+ * @return True if the attribute was found and a value was resolved.
+ */
+bool UUsdAttributeFunctionLibraryBPLibrary::GetCachedUsdAttributeValue(AUsdStageActor* StageActor, const FString& PrimName,
+    const FString& AttrName, TOptional<double> TimeSample, UE::FVtValue& OutValue)
+{
+    if (!StageActor)
+    {
+        UE_LOG(LogUsdAttributes, Error, TEXT("StageActor is null"));
+        return false;
+    }
+
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found"));
+        return false;
+    }
 
+    return GetCachedUsdAttributeValue(*StageCache, PrimName, AttrName, TimeSample, OutValue);
+}
 
 /**
- * @brief Retrieves a Vec3 attribute from a Usd prim and converts it to an Unreal FVector.
+ * @brief Resolves the value of a Usd attribute through a stage cache that has already been found.
  * 
- * Gets the specified Vec3 attribute from the given prim in the Usd stage and converts it to an FVector. 
- * Vec3f, Vec3d, and Vec3i types are supported.
+ * Doesn't touch the stage actor, so it can be called from worker tasks.
+ * 
+ * @param StageCache The cache for the stage to read from.
+ * @param PrimName The name of the USD prim to search for.
+ * @param AttrName The name of the attribute to retrieve from the prim.
+ * @param TimeSample The time sample to read, or unset to read the default value.
+ * @param OutValue The resolved attribute value.
+ * @return True if the attribute was found and a value was resolved.
+ */
+bool UUsdAttributeFunctionLibraryBPLibrary::GetCachedUsdAttributeValue(FUsdAttributeStageCache& StageCache, const FString& PrimName,
+    const FString& AttrName, TOptional<double> TimeSample, UE::FVtValue& OutValue)
+{
+    pxr::UsdAttributeQuery Query = StageCache.FindOrCreateAttributeQuery(PrimName, AttrName);
+    if (!Query.IsValid())
+    {
+        USD_ATTRIBUTE_INC_COUNTER(LookupMisses);
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Attribute found with name: %s on Prim: %s"), *AttrName, *PrimName);
+        return false;
+    }
+
+    return UsdAttributeQueryImpl::GetQueryValue(Query, AttrName, TimeSample, OutValue);
+}
+
+/**
+ * @brief Reads a time sampled attribute from its baked curve, its sampler or through Usd.
+ * 
+ * The stage cache and the attribute query are resolved once and shared by every source, so a read that
+ * falls through to Usd doesn't repeat the lookups the baked curve and sampler made. Baked curves are
+ * checked before the query is resolved, as they don't need it.
  * 
  * @param StageActor The current UsdStageActor.
- * @param PrimName The name of the Usd prim to search for.
- * @param AttrName The name of the Vec3 attribute to retrieve from the prim.
- * @return An FVector representing the Vec3 attribute, or a default FVector if an error occurs.
+ * @param PrimName The name of the USD prim.
+ * @param AttrName The name of the attribute.
+ * @param TimeSample The time to read at.
+ * @param OutComponents Receives NumComponents values when read from a baked curve or sampler.
+ * @param NumComponents The number of values the caller's type is made of, or 0 if it can't be baked or sampled.
+ * @param bOutReadComponents Set to true if OutComponents was filled rather than OutValue.
+ * @param OutValue The value resolved through Usd.
+ * @return True if a value was read.
  */
-FVector UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec3Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+bool UUsdAttributeFunctionLibraryBPLibrary::GetAnimatedUsdAttributeValue(AUsdStageActor* StageActor, const FString& PrimName,
+    const FString& AttrName, double TimeSample, double* OutComponents, int32 NumComponents, bool& bOutReadComponents, UE::FVtValue& OutValue)
 {
-#if USE_USD_SDK
-    // Retrieve the Usd attribute from the specified prim
-    UE::FUsdAttribute Attr = GetUsdAttributeInternal(StageActor, PrimName, AttrName);
-    if (!Attr)
+    bOutReadComponents = false;
+
+    if (!StageActor)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Specified attribute is not holding any value"));
-        return FVector();
+        UE_LOG(LogUsdAttributes, Error, TEXT("StageActor is null"));
+        return false;
     }
 
-    UE::FVtValue Value;
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found"));
+        return false;
+    }
 
-    // Get the value of the attribute
-    bool bSuccess = Attr.Get(Value);
-    if (!bSuccess)
+    if (NumComponents > 0 && EvaluateBakedUsdAttribute(*StageCache, PrimName, AttrName, TimeSample, OutComponents, NumComponents))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Failed to get value for Attribute: %s"), *Attr.GetName().ToString());
-        return FVector();
+        bOutReadComponents = true;
+        return true;
     }
 
-    // Retrieve the underlying pxr::VtValue and its type
-    pxr::VtValue& PxrValue = Value.GetUsdValue();
-    pxr::TfType PxrValueType = PxrValue.GetType();
+    pxr::UsdAttributeQuery Query = StageCache->FindOrCreateAttributeQuery(PrimName, AttrName);
+    if (!Query.IsValid())
+    {
+        USD_ATTRIBUTE_INC_COUNTER(LookupMisses);
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Attribute found with name: %s on Prim: %s"), *AttrName, *PrimName);
+        return false;
+    }
 
-    // Check the type of the value and convert it to an FVector accordingly
-    if (PxrValueType.IsA<pxr::GfVec3f>())
+    if (NumComponents > 0 && EvaluateSampledUsdAttribute(*StageCache, Query, PrimName, AttrName, TimeSample, OutComponents, NumComponents))
     {
-        UE_LOG(LogTemp, Log, TEXT("Vec3f"));
-        return ConvertUsdVectorToFVector<pxr::GfVec3f>(PxrValue);
+        bOutReadComponents = true;
+        return true;
     }
-    else if (PxrValueType.IsA<pxr::GfVec3d>())
+
+    return UsdAttributeQueryImpl::GetQueryValue(Query, AttrName, TimeSample, OutValue);
+}
+
+/**
+ * @brief Evaluates the baked curve of an attribute, if baked curves are enabled for the stage.
+ * 
+ * @param StageCache The cache for the stage to read from.
+ * @param PrimName The name of the USD prim.
+ * @param AttrName The name of the attribute.
+ * @param TimeSample The time to evaluate the curve at.
+ * @param OutComponents Receives NumComponents values.
+ * @param NumComponents The number of values expected per sample.
+ * @return True if a baked curve with the expected layout was evaluated.
+ */
+bool UUsdAttributeFunctionLibraryBPLibrary::EvaluateBakedUsdAttribute(FUsdAttributeStageCache& StageCache, const FString& PrimName,
+    const FString& AttrName, double TimeSample, double* OutComponents, int32 NumComponents)
+{
+    if (!StageCache.IsUsingBakedCurves())
     {
-        UE_LOG(LogTemp, Log, TEXT("Vec3d"));
-        return ConvertUsdVectorToFVector<pxr::GfVec3d>(PxrValue);
+        return false;
     }
-    else if (PxrValueType.IsA<pxr::GfVec3i>())
+
+    const FUsdBakedAttributeCurve* Curve = StageCache.FindBakedCurve(PrimName, AttrName);
+    if (!Curve || Curve->NumComponents != NumComponents || !Curve->Evaluate(TimeSample, OutComponents))
     {
-        UE_LOG(LogTemp, Log, TEXT("Vec3i"));
-        return ConvertUsdVectorToFVector<pxr::GfVec3i>(PxrValue);
+        return false;
     }
-    else
+
+    USD_ATTRIBUTE_INC_COUNTER(BakedCurveReads);
+    return true;
+}
+
+/**
+ * @brief Samples an attribute through its stage cache sampler, if its interpolation has been set.
+ * 
+ * @param StageCache The cache for the stage to read from.
+ * @param Query The attribute's query, already resolved by the caller.
+ * @param PrimName The name of the USD prim.
+ * @param AttrName The name of the attribute.
+ * @param TimeSample The time to sample at.
+ * @param OutComponents Receives NumComponents values.
+ * @param NumComponents The number of values expected per sample.
+ * @return True if a sampler with the expected layout was evaluated.
+ */
+bool UUsdAttributeFunctionLibraryBPLibrary::EvaluateSampledUsdAttribute(FUsdAttributeStageCache& StageCache, const pxr::UsdAttributeQuery& Query,
+    const FString& PrimName, const FString& AttrName, double TimeSample, double* OutComponents, int32 NumComponents)
+{
+    FUsdAttributeSampler* Sampler = StageCache.FindOrCreateSampler(Query, PrimName, AttrName);
+    if (!Sampler || Sampler->GetNumComponents() != NumComponents || !Sampler->Sample(TimeSample, OutComponents))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Unsupported type for Attribute."));
-        return FVector();
+        return false;
     }
 
+    USD_ATTRIBUTE_INC_COUNTER(SamplerReads);
+    return true;
+}
+
+#endif
+
+
+/**
+ * @brief Retrieves a Vec3 attribute from a Usd prim and converts it to an Unreal FVector.
+ * 
+ * Gets the specified Vec3 attribute from the given prim in the Usd stage and converts it to an FVector. 
+ * Vec3h, Vec3f, Vec3d, and Vec3i types are supported.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param PrimName The name of the Usd prim to search for.
+ * @param AttrName The name of the Vec3 attribute to retrieve from the prim.
+ * @return An FVector representing the Vec3 attribute, or a default FVector if an error occurs.
+ */
+FVector UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec3Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(Vec3);
+
+    return GetUsdAttributeValueInternal<FVector>(StageActor, PrimName, AttrName);
 #else
     // Log a warning if the USD SDK is not enabled
-    UE_LOG(LogTemp, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
     return FVector();
 #endif
 }
@@ -164,45 +310,11 @@ FVector UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3Attribute(AUsdS
 	FString AttrName, double TimeSample)
 {
 #if USE_USD_SDK
-	UE::FUsdAttribute Attr = GetUsdAttributeInternal(StageActor, PrimName, AttrName);
-
-	if (!Attr)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Specified attribute is not holding any value"))
-		return FVector();
-	}
+	USD_ATTRIBUTE_SCOPE_CALL(AnimatedVec3);
 
-	UE::FVtValue Value;
-
-	bool bSuccess = Attr.Get(Value, TimeSample);
-
-	if (!bSuccess)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to get animated value for Attribute: %s"), *Attr.GetName().ToString());
-		return FVector();
-	}
-
-	pxr::VtValue& PxrValue = Value.GetUsdValue();
-	pxr::TfType PxrValueType = PxrValue.GetType();
-
-	if (PxrValueType.IsA<pxr::GfVec3f>()) {
-		UE_LOG(LogTemp, Warning, TEXT("Vec3f"));
-	
-		return ConvertUsdVectorToFVector<pxr::GfVec3f>(PxrValue);
-	} else if (PxrValueType.IsA<pxr::GfVec3d>()) {
-		UE_LOG(LogTemp, Warning, TEXT("Vec3d"));
-	
-		return ConvertUsdVectorToFVector<pxr::GfVec3d>(PxrValue);
-	} else if (PxrValueType.IsA<pxr::GfVec3i>()) {
-		UE_LOG(LogTemp, Warning, TEXT("Vec3i"));
-	
-		return ConvertUsdVectorToFVector<pxr::GfVec3i>(PxrValue);
-	} else {
-		UE_LOG(LogTemp, Warning, TEXT("Unsupported type for Attribute."));
-		return FVector();
-	}
+	return GetUsdAnimatedAttributeValueInternal<FVector>(StageActor, PrimName, AttrName, TimeSample);
 #else
-	UE_LOG(LogTemp, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"))
+	UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"))
 	return FVector();
 #endif
 }
@@ -211,6 +323,8 @@ float UUsdAttributeFunctionLibraryBPLibrary::GetUsdFloatAttribute(AUsdStageActor
                                                                   FString AttrName)
 {
 #if USE_USD_SDK
+	USD_ATTRIBUTE_SCOPE_CALL(Float);
+
 	return GetUsdAttributeValueInternal<float>(StageActor, PrimName, AttrName);
 #else
 	return 0.0;
@@ -222,6 +336,8 @@ float UUsdAttributeFunctionLibraryBPLibrary::GetUsdFloatAttribute(AUsdStageActor
 double UUsdAttributeFunctionLibraryBPLibrary::GetUsdDoubleAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
 {
 #if USE_USD_SDK
+	USD_ATTRIBUTE_SCOPE_CALL(Double);
+
 	return GetUsdAttributeValueInternal<double>(StageActor, PrimName, AttrName);
 #else
 	return 0.0;
@@ -233,6 +349,8 @@ int UUsdAttributeFunctionLibraryBPLibrary::GetUsdIntAttribute(AUsdStageActor* St
 {
 #if USE_USD_SDK
 
+	USD_ATTRIBUTE_SCOPE_CALL(Int);
+
 	return GetUsdAttributeValueInternal<int>(StageActor, PrimName, AttrName);
 #else
 	return 0;
@@ -243,6 +361,8 @@ float UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttribute(AUsdSt
                                                                           FString AttrName, double TimeSample)
 {
 #if USE_USD_SDK
+	USD_ATTRIBUTE_SCOPE_CALL(AnimatedFloat);
+
 	if (float FoundValue = GetUsdAnimatedAttributeValueInternal<float>(StageActor, PrimName, AttrName, TimeSample))
 	{
 		return FoundValue;
@@ -258,6 +378,8 @@ double UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedDoubleAttribute(AUsd
 	FString PrimName, FString AttrName, double TimeSample)
 {
 #if USE_USD_SDK
+	USD_ATTRIBUTE_SCOPE_CALL(AnimatedDouble);
+
 	if (double FoundValue = GetUsdAnimatedAttributeValueInternal<double>(StageActor, PrimName, AttrName, TimeSample))
 	{
 		return FoundValue;
@@ -272,6 +394,8 @@ int UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedIntAttribute(AUsdStageA
 	FString AttrName, double TimeSample)
 {
 #if USE_USD_SDK
+	USD_ATTRIBUTE_SCOPE_CALL(AnimatedInt);
+
 	if (int FoundValue = GetUsdAnimatedAttributeValueInternal<int>(StageActor, PrimName, AttrName, TimeSample))
 	{
 		return FoundValue;
@@ -282,60 +406,941 @@ int UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedIntAttribute(AUsdStageA
 #endif
 }
 
-FRotator UUsdAttributeFunctionLibraryBPLibrary::ConvertToUnrealRotator(FVector InputVector)
+/**
+ * The remaining getters only differ by the Unreal type they return, the Usd types each one accepts
+ * are listed with their conversions in UsdAttributeTypeRegistry.h
+ */
+bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdBoolAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
 {
-	return FRotator(InputVector[0], (InputVector[1]*-1)-90, InputVector[2]);
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
+
+    return GetUsdAttributeValueInternal<bool>(StageActor, PrimName, AttrName);
+#else
+    return false;
+#endif
 }
 
+FVector2D UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec2Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
 #if USE_USD_SDK
-void UUsdAttributeFunctionLibraryBPLibrary::GetSdfPathWithName(UE::FUsdPrim& CurrentPrim, FString TargetName,
-                                                               UE::FSdfPath& OutPath)
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
+
+    return GetUsdAttributeValueInternal<FVector2D>(StageActor, PrimName, AttrName);
+#else
+    return FVector2D::ZeroVector;
+#endif
+}
+
+FVector4 UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec4Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
 {
-	if (!CurrentPrim)
-	{
-		UE_LOG(LogTemp, Error, TEXT("CurrentPrim is invalid"));
-		return;
-	}
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
 
-	// UE_LOG(LogTemp, Log, TEXT("Searching in Prim: %s"), *CurrentPrim.GetName().ToString());
+    return GetUsdAttributeValueInternal<FVector4>(StageActor, PrimName, AttrName);
+#else
+    return FVector4(0.0, 0.0, 0.0, 0.0);
+#endif
+}
 
-	if (CurrentPrim.GetName().ToString().Equals(TargetName))
-	{
-		OutPath = CurrentPrim.GetPrimPath();
-		UE_LOG(LogTemp, Log, TEXT("Found Prim: %s with TargetName: %s"), *CurrentPrim.GetName().ToString(), *TargetName);
-		return;
-	}
-    
-	for (UE::FUsdPrim& Child : CurrentPrim.GetChildren())
-	{
-		if (!Child)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Encountered invalid child prim"));
-			continue;
-		}
+FQuat UUsdAttributeFunctionLibraryBPLibrary::GetUsdQuatAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
 
-		GetSdfPathWithName(Child, TargetName, OutPath);
+    return GetUsdAttributeValueInternal<FQuat>(StageActor, PrimName, AttrName);
+#else
+    return FQuat::Identity;
+#endif
+}
 
-		if (!OutPath.IsEmpty())
-		{
-			return;
-		}
-	}
-	// UE_LOG(LogTemp, Log, TEXT("Finished searching children of Prim: %s"), *CurrentPrim.GetName().ToString());
+FMatrix UUsdAttributeFunctionLibraryBPLibrary::GetUsdMatrixAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
+
+    return GetUsdAttributeValueInternal<FMatrix>(StageActor, PrimName, AttrName);
+#else
+    return FMatrix::Identity;
+#endif
 }
+
+FString UUsdAttributeFunctionLibraryBPLibrary::GetUsdStringAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
+
+    return GetUsdAttributeValueInternal<FString>(StageActor, PrimName, AttrName);
+#else
+    return FString();
 #endif
+}
 
+FLinearColor UUsdAttributeFunctionLibraryBPLibrary::GetUsdColorAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
 #if USE_USD_SDK
-template float UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<float>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
-template int UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<int>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
-template double UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<double>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+    USD_ATTRIBUTE_SCOPE_CALL(Other);
 
-template float UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<float>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
-template int UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<int>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
-template double UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<double>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+    return GetUsdAttributeValueInternal<FLinearColor>(StageActor, PrimName, AttrName);
+#else
+    return FLinearColor::Black;
+#endif
+}
 
-template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3f>(const pxr::VtValue& pxrValue);
-template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3d>(const pxr::VtValue& pxrValue);
-template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3i>(const pxr::VtValue& pxrValue);
+bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedBoolAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<bool>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return false;
+#endif
+}
+
+FVector2D UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec2Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<FVector2D>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return FVector2D::ZeroVector;
+#endif
+}
+
+FVector4 UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec4Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<FVector4>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return FVector4(0.0, 0.0, 0.0, 0.0);
+#endif
+}
+
+FQuat UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedQuatAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<FQuat>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return FQuat::Identity;
+#endif
+}
+
+FMatrix UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedMatrixAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<FMatrix>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return FMatrix::Identity;
+#endif
+}
+
+FString UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedStringAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<FString>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return FString();
+#endif
+}
+
+FLinearColor UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedColorAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    USD_ATTRIBUTE_SCOPE_CALL(AnimatedOther);
+
+    return GetUsdAnimatedAttributeValueInternal<FLinearColor>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return FLinearColor::Black;
 #endif
+}
+
+#if USE_USD_SDK
+/**
+ * @brief Reads an array valued attribute, sharing the buffer resolved by Usd rather than copying it.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param PrimName The name of the USD prim to search for.
+ * @param AttrName The name of the array attribute to retrieve from the prim.
+ * @param TimeSample The time sample to read, or unset to read the default value.
+ * @param OutArray The resolved array.
+ * @return True if the attribute was found and holds an array of ElementType.
+ */
+template <typename ElementType>
+bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute(AUsdStageActor* StageActor, const FString& PrimName,
+    const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<ElementType>& OutArray)
+{
+    UE::FVtValue Value;
+    if (!GetCachedUsdAttributeValue(StageActor, PrimName, AttrName, TimeSample, Value))
+    {
+        return false;
+    }
+
+    pxr::VtValue& PxrValue = Value.GetUsdValue();
+    if (!PxrValue.IsHolding<pxr::VtArray<ElementType>>())
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Attribute: %s is not holding an array of the specified type"), *AttrName);
+        return false;
+    }
+
+    PxrValue.UncheckedSwap(OutArray);
+    return true;
+}
+
+namespace UsdAttributeArrayImpl
+{
+    /** Copies a scalar array attribute into a TArray with a single memcpy. */
+    template <typename ElementType>
+    TArray<ElementType> GetScalarArray(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample)
+    {
+        USD_ATTRIBUTE_SCOPE_CALL(Array);
+
+        pxr::VtArray<ElementType> UsdArray;
+        if (!UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute(StageActor, PrimName, AttrName, TimeSample, UsdArray))
+        {
+            return TArray<ElementType>();
+        }
+        return TArray<ElementType>(UsdArray.cdata(), static_cast<int32>(UsdArray.size()));
+    }
+
+    TArray<FVector2D> GetVec2Array(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample)
+    {
+        USD_ATTRIBUTE_SCOPE_CALL(Array);
+
+        TArray<FVector2D> Result;
+        pxr::VtArray<pxr::GfVec2f> UsdArray;
+        if (UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute(StageActor, PrimName, AttrName, TimeSample, UsdArray))
+        {
+            UsdAttributeArrays::ConvertVectors(UsdAttributeArrays::MakeArrayView(UsdArray), Result);
+        }
+        return Result;
+    }
+
+    TArray<FVector> GetVec3Array(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, EUsdVectorConversion Conversion)
+    {
+        USD_ATTRIBUTE_SCOPE_CALL(Array);
+
+        TArray<FVector> Result;
+        UE::FVtValue Value;
+        if (!UUsdAttributeFunctionLibraryBPLibrary::GetCachedUsdAttributeValue(StageActor, PrimName, AttrName, TimeSample, Value))
+        {
+            return Result;
+        }
+
+        const pxr::VtValue& PxrValue = Value.GetUsdValue();
+        const UsdAttributeArrays::FUsdAxisConversion AxisConversion = UsdAttributeArrays::FUsdAxisConversion::FromStage(StageActor->GetUsdStage(), Conversion);
+
+        switch (PxrValue.GetKnownValueTypeIndex())
+        {
+        case pxr::VtGetKnownValueTypeIndex<pxr::VtVec3fArray>():
+            UsdAttributeArrays::ConvertVectors(UsdAttributeArrays::MakeArrayView(PxrValue.UncheckedGet<pxr::VtVec3fArray>()), AxisConversion, Result);
+            break;
+        case pxr::VtGetKnownValueTypeIndex<pxr::VtVec3dArray>():
+            UsdAttributeArrays::ConvertVectors(UsdAttributeArrays::MakeArrayView(PxrValue.UncheckedGet<pxr::VtVec3dArray>()), AxisConversion, Result);
+            break;
+        default:
+            UE_LOG(LogUsdAttributes, Warning, TEXT("Attribute: %s is not holding a Vec3f or Vec3d array"), *AttrName);
+            break;
+        }
+        return Result;
+    }
+}
+#endif
+
+TArray<float> UUsdAttributeFunctionLibraryBPLibrary::GetUsdFloatArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetScalarArray<float>(StageActor, PrimName, AttrName, TOptional<double>());
+#else
+    return TArray<float>();
+#endif
+}
+
+TArray<int> UUsdAttributeFunctionLibraryBPLibrary::GetUsdIntArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetScalarArray<int>(StageActor, PrimName, AttrName, TOptional<double>());
+#else
+    return TArray<int>();
+#endif
+}
+
+TArray<FVector2D> UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec2ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetVec2Array(StageActor, PrimName, AttrName, TOptional<double>());
+#else
+    return TArray<FVector2D>();
+#endif
+}
+
+TArray<FVector> UUsdAttributeFunctionLibraryBPLibrary::GetUsdVec3ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, EUsdVectorConversion Conversion)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetVec3Array(StageActor, PrimName, AttrName, TOptional<double>(), Conversion);
+#else
+    return TArray<FVector>();
+#endif
+}
+
+TArray<float> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetScalarArray<float>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return TArray<float>();
+#endif
+}
+
+TArray<int> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedIntArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetScalarArray<int>(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return TArray<int>();
+#endif
+}
+
+TArray<FVector2D> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec2ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetVec2Array(StageActor, PrimName, AttrName, TimeSample);
+#else
+    return TArray<FVector2D>();
+#endif
+}
+
+TArray<FVector> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample, EUsdVectorConversion Conversion)
+{
+#if USE_USD_SDK
+    return UsdAttributeArrayImpl::GetVec3Array(StageActor, PrimName, AttrName, TimeSample, Conversion);
+#else
+    return TArray<FVector>();
+#endif
+}
+
+/**
+ * @brief Bakes time sampled attributes into dense curves for fast playback.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param Requests The attributes to bake and how to interpolate them.
+ * @return The number of attributes that were baked.
+ */
+int32 UUsdAttributeFunctionLibraryBPLibrary::BakeUsdAttributeCurves(AUsdStageActor* StageActor, const TArray<FUsdAttributeCurveRequest>& Requests)
+{
+#if USE_USD_SDK
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found, unable to bake attribute curves"));
+        return 0;
+    }
+
+    int32 NumBaked = 0;
+    for (const FUsdAttributeCurveRequest& Request : Requests)
+    {
+        if (StageCache->BakeCurve(Request.PrimName, Request.AttrName, Request.Interpolation))
+        {
+            ++NumBaked;
+        }
+    }
+    return NumBaked;
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+    return 0;
+#endif
+}
+
+void UUsdAttributeFunctionLibraryBPLibrary::SetUseBakedUsdAttributeCurves(AUsdStageActor* StageActor, bool bUseBakedCurves)
+{
+#if USE_USD_SDK
+    if (TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor))
+    {
+        StageCache->SetUseBakedCurves(bUseBakedCurves);
+    }
+#endif
+}
+
+void UUsdAttributeFunctionLibraryBPLibrary::ClearBakedUsdAttributeCurves(AUsdStageActor* StageActor)
+{
+#if USE_USD_SDK
+    if (TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor))
+    {
+        StageCache->ClearBakedCurves();
+    }
+#endif
+}
+
+void UUsdAttributeFunctionLibraryBPLibrary::SetUsdAttributeInterpolation(AUsdStageActor* StageActor, FString PrimName, FString AttrName, EUsdAttributeInterpolation Interpolation)
+{
+#if USE_USD_SDK
+    if (TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor))
+    {
+        StageCache->SetInterpolation(PrimName, AttrName, Interpolation);
+    }
+    else
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found, unable to set interpolation of Attribute: %s on Prim: %s"), *AttrName, *PrimName);
+    }
+#endif
+}
+
+void UUsdAttributeFunctionLibraryBPLibrary::ResetUsdAttributeInterpolation(AUsdStageActor* StageActor, FString PrimName, FString AttrName)
+{
+#if USE_USD_SDK
+    if (TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor))
+    {
+        StageCache->SetInterpolation(PrimName, AttrName, TOptional<EUsdAttributeInterpolation>());
+    }
+#endif
+}
+
+/**
+ * @brief Reads several Usd attributes in a single call.
+ * 
+ * Resolves the stage cache once, then visits the requests grouped by prim name so that each prim
+ * is only searched for once, reading every value through the cached attribute queries.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param Requests The prim, attribute, type and time of each value to read.
+ * @param Results The value and status of each request, in the same order as Requests.
+ */
+void UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributesBatch(AUsdStageActor* StageActor,
+    const TArray<FUsdAttributeRequest>& Requests, TArray<FUsdAttributeResult>& Results)
+{
+    Results.Reset(Requests.Num());
+    Results.SetNum(Requests.Num());
+
+#if USE_USD_SDK
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found for batch of %d attributes"), Requests.Num());
+        for (FUsdAttributeResult& Result : Results)
+        {
+            Result.Status = EUsdAttributeStatus::StageNotFound;
+        }
+        return;
+    }
+
+    ReadUsdAttributesBatch(*StageCache, Requests, Results);
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+    for (FUsdAttributeResult& Result : Results)
+    {
+        Result.Status = EUsdAttributeStatus::StageNotFound;
+    }
+#endif
+}
+
+FUsdAttributeSubscriptionHandle UUsdAttributeFunctionLibraryBPLibrary::SubscribeToUsdAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName,
+    EUsdAttributeValueType Type, FUsdAttributeChangedDynamic OnChanged)
+{
+#if USE_USD_SDK
+    if (!StageActor)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage Actor to subscribe to Attribute: %s on Prim: %s"), *AttrName, *PrimName);
+        return FUsdAttributeSubscriptionHandle();
+    }
+
+    // Bound weakly to the event's object, so the subscription is dropped along with it
+    FOnUsdAttributeChanged OnValueChanged = FOnUsdAttributeChanged::CreateWeakLambda(OnChanged.GetUObject(),
+        [OnChanged, Type](const pxr::VtValue& Value)
+        {
+            FUsdAttributeResult Result;
+            if (!Value.IsEmpty())
+            {
+                UsdAttributeTypeRegistry::ConvertUsdValueToResult(Value, Type, Result);
+            }
+            OnChanged.ExecuteIfBound(Result);
+        });
+
+    return FUsdAttributeSubscriptions::Get().Subscribe(StageActor, PrimName, AttrName, MoveTemp(OnValueChanged));
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+    return FUsdAttributeSubscriptionHandle();
+#endif
+}
+
+void UUsdAttributeFunctionLibraryBPLibrary::UnsubscribeFromUsdAttribute(FUsdAttributeSubscriptionHandle& Handle)
+{
+#if USE_USD_SDK
+    FUsdAttributeSubscriptions::Get().Unsubscribe(Handle);
+#endif
+    Handle = FUsdAttributeSubscriptionHandle();
+}
+
+TArray<FString> UUsdAttributeFunctionLibraryBPLibrary::FindUsdPrimPaths(AUsdStageActor* StageActor, FString PrimName)
+{
+    TArray<FString> Result;
+#if USE_USD_SDK
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found, unable to find prims matching: %s"), *PrimName);
+        return Result;
+    }
+
+    TArray<pxr::SdfPath> Paths;
+    StageCache->FindPrimPaths(PrimName, Paths);
+
+    Result.Reserve(Paths.Num());
+    for (const pxr::SdfPath& Path : Paths)
+    {
+        Result.Add(UTF8_TO_TCHAR(Path.GetText()));
+    }
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+#endif
+    return Result;
+}
+
+TArray<FString> UUsdAttributeFunctionLibraryBPLibrary::FindUsdPrimsWithAttribute(AUsdStageActor* StageActor, FString AttrName, bool bCustomOnly,
+    TArray<FString>& OutAttrNames)
+{
+    TArray<FString> Result;
+    OutAttrNames.Reset();
+#if USE_USD_SDK
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found, unable to find prims with attribute: %s"), *AttrName);
+        return Result;
+    }
+
+    TArray<pxr::SdfPath> Paths;
+    TArray<pxr::TfToken> Names;
+    StageCache->FindPrimPathsWithAttribute(AttrName, bCustomOnly, Paths, &Names);
+
+    Result.Reserve(Paths.Num());
+    OutAttrNames.Reserve(Names.Num());
+    for (int32 Index = 0; Index < Paths.Num(); ++Index)
+    {
+        Result.Add(UTF8_TO_TCHAR(Paths[Index].GetText()));
+        OutAttrNames.Add(UTF8_TO_TCHAR(Names[Index].GetText()));
+    }
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+#endif
+    return Result;
+}
+
+#if USE_USD_SDK
+/**
+ * @brief Reads several Usd attributes through a stage cache that has already been found.
+ * 
+ * Doesn't touch the stage actor, so it can be called from worker tasks.
+ * 
+ * @param StageCache The cache for the stage to read from.
+ * @param Requests The prim, attribute, type and time of each value to read.
+ * @param Results The value and status of each request, which must already be sized to match Requests.
+ * @param RequestsToRead If set, only the requests whose bit is set are read and the other results are left untouched.
+ */
+void UUsdAttributeFunctionLibraryBPLibrary::ReadUsdAttributesBatch(FUsdAttributeStageCache& StageCache,
+    const TArray<FUsdAttributeRequest>& Requests, TArray<FUsdAttributeResult>& Results, const TBitArray<>* RequestsToRead)
+{
+    USD_ATTRIBUTE_SCOPE_CALL(Batch);
+
+    // Visit the requests grouped by prim, keeping the original order within each prim
+    TArray<int32> Order;
+    Order.Reserve(Requests.Num());
+    for (int32 Index = 0; Index < Requests.Num(); ++Index)
+    {
+        if (!RequestsToRead || (*RequestsToRead)[Index])
+        {
+            Order.Add(Index);
+        }
+    }
+    Algo::StableSortBy(Order, [&Requests](int32 Index) -> const FString& { return Requests[Index].PrimName; },
+        [](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+
+    const FString* GroupPrimName = nullptr;
+    pxr::UsdPrim GroupPrim;
+    bool bGroupPrimSearched = false;
+    pxr::VtValue PxrValue;
+
+    for (int32 Index : Order)
+    {
+        const FUsdAttributeRequest& Request = Requests[Index];
+        FUsdAttributeResult& Result = Results[Index];
+
+        if (!GroupPrimName || !GroupPrimName->Equals(Request.PrimName, ESearchCase::CaseSensitive))
+        {
+            GroupPrimName = &Request.PrimName;
+            GroupPrim = pxr::UsdPrim();
+            bGroupPrimSearched = false;
+        }
+
+        pxr::UsdAttributeQuery Query = StageCache.FindAttributeQuery(Request.PrimName, Request.AttrName);
+        if (!Query.IsValid())
+        {
+            // Only search for the prim once per group, and only when one of its attributes isn't cached yet
+            if (!bGroupPrimSearched)
+            {
+                GroupPrim = StageCache.FindPrim(Request.PrimName);
+                bGroupPrimSearched = true;
+            }
+            Query = StageCache.CreateAttributeQuery(GroupPrim, Request.PrimName, Request.AttrName);
+        }
+
+        if (!Query.IsValid())
+        {
+            USD_ATTRIBUTE_INC_COUNTER(LookupMisses);
+            Result.Status = GroupPrim ? EUsdAttributeStatus::AttributeNotFound : EUsdAttributeStatus::PrimNotFound;
+            continue;
+        }
+
+        const pxr::UsdTimeCode TimeCode = Request.bAnimated ? pxr::UsdTimeCode(Request.TimeSample) : pxr::UsdTimeCode::Default();
+        if (!Query.Get(&PxrValue, TimeCode))
+        {
+            Result.Status = EUsdAttributeStatus::NoValue;
+            continue;
+        }
+
+        UsdAttributeTypeRegistry::ConvertUsdValueToResult(PxrValue, Request.Type, Result);
+    }
+}
+#endif
+
+#if USE_USD_SDK
+/**
+ * @brief Samples a Usd attribute over a time range, resolving the attribute once for all samples.
+ * 
+ * The attribute query is fetched from the stage cache once, and the authored time samples are
+ * found with a single interval query rather than by reading the value at every frame.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param PrimName The name of the USD prim to search for.
+ * @param AttrName The name of the attribute to retrieve from the prim.
+ * @param StartTime The first time of the range.
+ * @param EndTime The last time of the range, inclusive.
+ * @param Step The interval between samples, ignored when using the authored time samples.
+ * @param bUseAuthoredTimeSamples Whether to sample at the authored time samples within the range.
+ * @param OutTimes The times that were sampled.
+ * @param OutValues The attribute value at each of OutTimes.
+ * @return True if the attribute was found and every sample holds a value of type T.
+ */
+template <typename T>
+bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeRangeInternal(AUsdStageActor* StageActor, const FString& PrimName,
+    const FString& AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes, TArray<T>& OutValues)
+{
+    USD_ATTRIBUTE_SCOPE_CALL(Range);
+
+    OutTimes.Reset();
+    OutValues.Reset();
+
+    if (EndTime < StartTime)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Invalid time range %f - %f for Attribute: %s"), StartTime, EndTime, *AttrName);
+        return false;
+    }
+
+    TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor);
+    if (!StageCache)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found"));
+        return false;
+    }
+
+    pxr::UsdAttributeQuery Query = StageCache->FindOrCreateAttributeQuery(PrimName, AttrName);
+    if (!Query.IsValid())
+    {
+        USD_ATTRIBUTE_INC_COUNTER(LookupMisses);
+        UE_LOG(LogUsdAttributes, Warning, TEXT("No Attribute found with name: %s on Prim: %s"), *AttrName, *PrimName);
+        return false;
+    }
+
+    if (bUseAuthoredTimeSamples)
+    {
+        std::vector<double> TimeSamples;
+        Query.GetTimeSamplesInInterval(pxr::GfInterval(StartTime, EndTime), &TimeSamples);
+        OutTimes.Append(TimeSamples.data(), static_cast<int32>(TimeSamples.size()));
+    }
+    else
+    {
+        if (Step <= 0.0)
+        {
+            UE_LOG(LogUsdAttributes, Warning, TEXT("Step must be greater than zero to sample Attribute: %s"), *AttrName);
+            return false;
+        }
+
+        // Compute each time from the start rather than accumulating Step, so long ranges don't drift
+        const int32 NumSamples = FMath::FloorToInt32((EndTime - StartTime) / Step + UE_KINDA_SMALL_NUMBER) + 1;
+        OutTimes.Reserve(NumSamples);
+        for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+        {
+            OutTimes.Add(StartTime + SampleIndex * Step);
+        }
+    }
+
+    OutValues.SetNum(OutTimes.Num());
+
+    bool bAllConverted = true;
+    pxr::VtValue PxrValue;
+    for (int32 SampleIndex = 0; SampleIndex < OutTimes.Num(); ++SampleIndex)
+    {
+        if (!Query.Get(&PxrValue, pxr::UsdTimeCode(OutTimes[SampleIndex])) || !UsdAttributeTypeRegistry::ConvertUsdValue(PxrValue, OutValues[SampleIndex]))
+        {
+            OutValues[SampleIndex] = T();
+            bAllConverted = false;
+        }
+    }
+
+    if (!bAllConverted)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Attribute: %s is not holding a value of specified type for every sample"), *AttrName);
+    }
+
+    return bAllConverted;
+}
+#endif
+
+TArray<FVector> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedVec3AttributeRange(AUsdStageActor* StageActor, FString PrimName,
+    FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes)
+{
+    TArray<FVector> Values;
+#if USE_USD_SDK
+    GetUsdAnimatedAttributeRangeInternal<FVector>(StageActor, PrimName, AttrName, StartTime, EndTime, Step, bUseAuthoredTimeSamples, OutTimes, Values);
+#endif
+    return Values;
+}
+
+TArray<float> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedFloatAttributeRange(AUsdStageActor* StageActor, FString PrimName,
+    FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes)
+{
+    TArray<float> Values;
+#if USE_USD_SDK
+    GetUsdAnimatedAttributeRangeInternal<float>(StageActor, PrimName, AttrName, StartTime, EndTime, Step, bUseAuthoredTimeSamples, OutTimes, Values);
+#endif
+    return Values;
+}
+
+TArray<double> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedDoubleAttributeRange(AUsdStageActor* StageActor, FString PrimName,
+    FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes)
+{
+    TArray<double> Values;
+#if USE_USD_SDK
+    GetUsdAnimatedAttributeRangeInternal<double>(StageActor, PrimName, AttrName, StartTime, EndTime, Step, bUseAuthoredTimeSamples, OutTimes, Values);
+#endif
+    return Values;
+}
+
+TArray<int> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedIntAttributeRange(AUsdStageActor* StageActor, FString PrimName,
+    FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes)
+{
+    TArray<int> Values;
+#if USE_USD_SDK
+    GetUsdAnimatedAttributeRangeInternal<int>(StageActor, PrimName, AttrName, StartTime, EndTime, Step, bUseAuthoredTimeSamples, OutTimes, Values);
+#endif
+    return Values;
+}
+
+/**
+ * @brief Reads several Usd attributes on a worker task.
+ * 
+ * The stage cache is found here on the game thread, then prim lookup, attribute resolution and value
+ * extraction all run on the task graph, holding the cache's worker lock so edits wait for the read. The future is fulfilled from the game thread, so continuations
+ * attached with Then can safely touch UObjects.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param Requests The prim, attribute, type and time of each value to read.
+ * @return A future for the value and status of each request, in the same order as Requests.
+ */
+TFuture<TArray<FUsdAttributeResult>> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributesBatchAsync(AUsdStageActor* StageActor, TArray<FUsdAttributeRequest> Requests)
+{
+    check(IsInGameThread());
+
+    TArray<FUsdAttributeResult> Results;
+    Results.SetNum(Requests.Num());
+
+#if USE_USD_SDK
+    if (TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor))
+    {
+        TSharedRef<TPromise<TArray<FUsdAttributeResult>>> Promise = MakeShared<TPromise<TArray<FUsdAttributeResult>>>();
+        TFuture<TArray<FUsdAttributeResult>> Future = Promise->GetFuture();
+
+        Async(EAsyncExecution::TaskGraph, [StageCache, Promise, Requests = MoveTemp(Requests), Results = MoveTemp(Results)]() mutable
+        {
+            {
+                FReadScopeLock WorkerReadLock(StageCache->GetWorkerLock());
+                ReadUsdAttributesBatch(*StageCache, Requests, Results);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Promise, Results = MoveTemp(Results)]() mutable
+            {
+                Promise->SetValue(MoveTemp(Results));
+            });
+        });
+
+        return Future;
+    }
+
+    UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found for async batch of %d attributes"), Results.Num());
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+#endif
+
+    for (FUsdAttributeResult& Result : Results)
+    {
+        Result.Status = EUsdAttributeStatus::StageNotFound;
+    }
+    return MakeFulfilledPromise<TArray<FUsdAttributeResult>>(MoveTemp(Results)).GetFuture();
+}
+
+/**
+ * @brief Reads the value of a single Usd attribute on a worker task.
+ * 
+ * Follows GetUsdAttributesBatchAsync: the stage cache is found on the game thread, the read runs on the
+ * task graph and the future is fulfilled from the game thread. Baked curves are not used, as they are
+ * only safe to evaluate on the game thread.
+ * 
+ * @param StageActor The current UsdStageActor.
+ * @param PrimName The name of the USD prim to search for.
+ * @param AttrName The name of the attribute to retrieve from the prim.
+ * @param TimeSample The time sample to read, or unset to read the default value.
+ * @return A future for the value, which is unset if the attribute wasn't found or doesn't hold a T.
+ */
+template <typename T>
+TFuture<TOptional<T>> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueAsync(AUsdStageActor* StageActor, FString PrimName,
+    FString AttrName, TOptional<double> TimeSample)
+{
+    check(IsInGameThread());
+
+#if USE_USD_SDK
+    if (TSharedPtr<FUsdAttributeStageCache> StageCache = FUsdAttributeStageCache::FindOrCreate(StageActor))
+    {
+        TSharedRef<TPromise<TOptional<T>>> Promise = MakeShared<TPromise<TOptional<T>>>();
+        TFuture<TOptional<T>> Future = Promise->GetFuture();
+
+        Async(EAsyncExecution::TaskGraph, [StageCache, Promise, PrimName = MoveTemp(PrimName), AttrName = MoveTemp(AttrName), TimeSample]()
+        {
+            TOptional<T> Result;
+
+            {
+                FReadScopeLock WorkerReadLock(StageCache->GetWorkerLock());
+
+                UE::FVtValue Value;
+                T ConvertedValue{};
+                if (GetCachedUsdAttributeValue(*StageCache, PrimName, AttrName, TimeSample, Value)
+                    && UsdAttributeTypeRegistry::ConvertUsdValue(Value.GetUsdValue(), ConvertedValue))
+                {
+                    Result = ConvertedValue;
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Promise, Result = MoveTemp(Result)]() mutable
+            {
+                Promise->SetValue(MoveTemp(Result));
+            });
+        });
+
+        return Future;
+    }
+
+    UE_LOG(LogUsdAttributes, Warning, TEXT("No Usd Stage found"));
+#else
+    UE_LOG(LogUsdAttributes, Warning, TEXT("USE_USD_SDK not enabled, unable to access UsdValue"));
+#endif
+
+    return MakeFulfilledPromise<TOptional<T>>().GetFuture();
+}
+
+FRotator UUsdAttributeFunctionLibraryBPLibrary::ConvertToUnrealRotator(FVector InputVector)
+{
+	return FRotator(InputVector[0], (InputVector[1]*-1)-90, InputVector[2]);
+}
+
+#if USE_USD_SDK
+void UUsdAttributeFunctionLibraryBPLibrary::GetSdfPathWithName(UE::FUsdPrim& CurrentPrim, FString TargetName,
+                                                               UE::FSdfPath& OutPath)
+{
+	if (!CurrentPrim)
+	{
+		UE_LOG(LogUsdAttributes, Error, TEXT("CurrentPrim is invalid"));
+		return;
+	}
+
+	// UE_LOG(LogUsdAttributes, Log, TEXT("Searching in Prim: %s"), *CurrentPrim.GetName().ToString());
+
+	if (CurrentPrim.GetName().ToString().Equals(TargetName))
+	{
+		OutPath = CurrentPrim.GetPrimPath();
+		UE_LOG(LogUsdAttributes, Verbose, TEXT("Found Prim: %s with TargetName: %s"), *CurrentPrim.GetName().ToString(), *TargetName);
+		return;
+	}
+    
+	for (UE::FUsdPrim& Child : CurrentPrim.GetChildren())
+	{
+		if (!Child)
+		{
+			UE_LOG(LogUsdAttributes, Warning, TEXT("Encountered invalid child prim"));
+			continue;
+		}
+
+		GetSdfPathWithName(Child, TargetName, OutPath);
+
+		if (!OutPath.IsEmpty())
+		{
+			return;
+		}
+	}
+	// UE_LOG(LogUsdAttributes, Log, TEXT("Finished searching children of Prim: %s"), *CurrentPrim.GetName().ToString());
+}
+#endif
+
+#if USE_USD_SDK
+template float UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<float>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template int UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<int>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template double UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<double>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FVector UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FVector>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<bool>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FVector2D UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FVector2D>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FVector4 UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FVector4>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FQuat UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FQuat>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FMatrix UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FMatrix>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FString UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FString>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+template FLinearColor UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal<FLinearColor>(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+template float UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<float>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template int UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<int>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template double UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<double>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FVector UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FVector>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<bool>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FVector2D UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FVector2D>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FVector4 UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FVector4>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FQuat UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FQuat>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FMatrix UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FMatrix>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FString UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FString>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+template FLinearColor UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal<FLinearColor>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeRangeInternal<float>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes, TArray<float>& OutValues);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeRangeInternal<int>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes, TArray<int>& OutValues);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeRangeInternal<double>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes, TArray<double>& OutValues);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeRangeInternal<FVector>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes, TArray<FVector>& OutValues);
+
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute<float>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<float>& OutArray);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute<int>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<int>& OutArray);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute<pxr::GfVec2f>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<pxr::GfVec2f>& OutArray);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute<pxr::GfVec3f>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<pxr::GfVec3f>& OutArray);
+template bool UUsdAttributeFunctionLibraryBPLibrary::GetUsdArrayAttribute<pxr::GfVec3d>(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<pxr::GfVec3d>& OutArray);
+
+template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3f>(const pxr::VtValue& pxrValue);
+template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3d>(const pxr::VtValue& pxrValue);
+template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3i>(const pxr::VtValue& pxrValue);
+template FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector<pxr::GfVec3h>(const pxr::VtValue& pxrValue);
+#endif
+
+template TFuture<TOptional<float>> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueAsync<float>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, TOptional<double> TimeSample);
+template TFuture<TOptional<int>> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueAsync<int>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, TOptional<double> TimeSample);
+template TFuture<TOptional<double>> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueAsync<double>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, TOptional<double> TimeSample);
+template TFuture<TOptional<FVector>> UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueAsync<FVector>(AUsdStageActor* StageActor, FString PrimName, FString AttrName, TOptional<double> TimeSample);
 
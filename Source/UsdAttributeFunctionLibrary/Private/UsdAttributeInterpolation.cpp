@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeInterpolation.h"
+
+#include "Algo/BinarySearch.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec3i.h"
+#include "USDIncludesEnd.h"
+#endif
+
+int32 UsdAttributeInterpolation::FUsdSampleCursor::FindBracket(TArrayView<const double> Times, double Time)
+{
+    const int32 LastIndex = Times.Num() - 1;
+    Index = FMath::Clamp(Index, 0, LastIndex);
+
+    // Playback usually stays within the previous bracket or moves into the next one
+    if (Times[Index] <= Time)
+    {
+        if (Index == LastIndex || Time < Times[Index + 1])
+        {
+            return Index;
+        }
+        if (Index + 1 == LastIndex || Time < Times[Index + 2])
+        {
+            return ++Index;
+        }
+    }
+
+    // Otherwise the time has jumped, e.g. on a loop or seek, so search for the last sample at or before it
+    Index = FMath::Max(Algo::UpperBound(Times, Time) - 1, 0);
+    return Index;
+}
+
+void UsdAttributeInterpolation::Evaluate(EUsdAttributeInterpolation Interpolation, TArrayView<const double> Times, int32 Index, double Time,
+    const double* const Neighbours[4], int32 NumComponents, double* OutComponents)
+{
+    const double* Lower = Neighbours[1];
+    const double* Upper = Neighbours[2];
+
+    // Hold the value before the first sample, after the last sample, and everywhere for held attributes
+    if (Interpolation == EUsdAttributeInterpolation::Held || !Upper || Time <= Times[Index])
+    {
+        FMemory::Memcpy(OutComponents, Lower, NumComponents * sizeof(double));
+        return;
+    }
+
+    const double Span = Times[Index + 1] - Times[Index];
+    const double Alpha = (Time - Times[Index]) / Span;
+
+    if (Interpolation == EUsdAttributeInterpolation::Linear)
+    {
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            OutComponents[Component] = FMath::Lerp(Lower[Component], Upper[Component], Alpha);
+        }
+        return;
+    }
+
+    // Cubic Hermite with Catmull-Rom tangents from the neighbouring samples, falling back to the
+    // bracket's own slope at either end. Tangents are scaled to the bracket for unevenly spaced samples
+    const double* Previous = Neighbours[0];
+    const double* Next = Neighbours[3];
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        const double Slope = (Upper[Component] - Lower[Component]) / Span;
+        const double LowerTangent = Previous ? (Upper[Component] - Previous[Component]) / (Times[Index + 1] - Times[Index - 1]) : Slope;
+        const double UpperTangent = Next ? (Next[Component] - Lower[Component]) / (Times[Index + 2] - Times[Index]) : Slope;
+        OutComponents[Component] = FMath::CubicInterp(Lower[Component], LowerTangent * Span, Upper[Component], UpperTangent * Span, Alpha);
+    }
+}
+
+#if USE_USD_SDK
+int32 UsdAttributeInterpolation::GetNumComponents(const pxr::TfType& ValueType, bool& bOutCanInterpolate)
+{
+    bOutCanInterpolate = true;
+    if (ValueType.IsA<pxr::GfVec3f>() || ValueType.IsA<pxr::GfVec3d>())
+    {
+        return 3;
+    }
+    if (ValueType.IsA<float>() || ValueType.IsA<double>())
+    {
+        return 1;
+    }
+
+    bOutCanInterpolate = false;
+    if (ValueType.IsA<pxr::GfVec3i>())
+    {
+        return 3;
+    }
+    if (ValueType.IsA<int>())
+    {
+        return 1;
+    }
+    return 0;
+}
+
+bool UsdAttributeInterpolation::ReadComponents(const pxr::VtValue& Value, double* OutComponents)
+{
+    if (Value.IsHolding<float>())
+    {
+        OutComponents[0] = Value.UncheckedGet<float>();
+    }
+    else if (Value.IsHolding<double>())
+    {
+        OutComponents[0] = Value.UncheckedGet<double>();
+    }
+    else if (Value.IsHolding<int>())
+    {
+        OutComponents[0] = Value.UncheckedGet<int>();
+    }
+    else if (Value.IsHolding<pxr::GfVec3f>())
+    {
+        const pxr::GfVec3f& Vec = Value.UncheckedGet<pxr::GfVec3f>();
+        OutComponents[0] = Vec[0]; OutComponents[1] = Vec[1]; OutComponents[2] = Vec[2];
+    }
+    else if (Value.IsHolding<pxr::GfVec3d>())
+    {
+        const pxr::GfVec3d& Vec = Value.UncheckedGet<pxr::GfVec3d>();
+        OutComponents[0] = Vec[0]; OutComponents[1] = Vec[1]; OutComponents[2] = Vec[2];
+    }
+    else if (Value.IsHolding<pxr::GfVec3i>())
+    {
+        const pxr::GfVec3i& Vec = Value.UncheckedGet<pxr::GfVec3i>();
+        OutComponents[0] = Vec[0]; OutComponents[1] = Vec[1]; OutComponents[2] = Vec[2];
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+#endif
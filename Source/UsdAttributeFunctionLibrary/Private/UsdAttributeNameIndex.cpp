@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeNameIndex.h"
+#include "UsdAttributeFunctionLibrary.h"
+#include "UsdPrimPathPattern.h"
+
+#if USE_USD_SDK
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdAttributeNameIndexImpl
+{
+    /** Prims are read in chunks of this many, so small stages and subtrees stay on the calling thread. */
+    constexpr int32 ChunkSize = 256;
+}
+
+FUsdAttributeNameIndex::FUsdAttributeNameIndex(const UE::FUsdStage& Stage)
+{
+    Build(Stage);
+}
+
+void FUsdAttributeNameIndex::FindPrimPaths(const FString& AttrName, bool bCustomOnly, TArray<pxr::SdfPath>& OutPrimPaths, TArray<pxr::TfToken>* OutAttrNames) const
+{
+    auto AddMatches = [bCustomOnly, &OutPrimPaths, OutAttrNames](const pxr::TfToken& Name, const TArray<FIndexedPrim>& Prims)
+    {
+        for (const FIndexedPrim& Prim : Prims)
+        {
+            if (!bCustomOnly || Prim.bCustom)
+            {
+                OutPrimPaths.Add(Prim.Path);
+                if (OutAttrNames)
+                {
+                    OutAttrNames->Add(Name);
+                }
+            }
+        }
+    };
+
+    // Attribute names may hold namespaces but never path separators, so a name is either exact or a wildcard
+    const FUsdPrimPathPattern::EKind Kind = FUsdPrimPathPattern::Classify(AttrName);
+    if (Kind == FUsdPrimPathPattern::EKind::Name)
+    {
+        // Find doesn't register new tokens, and an unregistered token can't be the name of any attribute
+        const pxr::TfToken NameToken = pxr::TfToken::Find(TCHAR_TO_UTF8(*AttrName));
+        if (const TArray<FIndexedPrim>* Prims = NameToken.IsEmpty() ? nullptr : PrimsByAttribute.Find(NameToken))
+        {
+            AddMatches(NameToken, *Prims);
+        }
+        return;
+    }
+
+    if (Kind != FUsdPrimPathPattern::EKind::NameWildcard)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Attribute names can only be matched with * and ? wildcards: %s"), *AttrName);
+        return;
+    }
+
+    TSharedRef<const FUsdPrimPathPattern> Pattern = FUsdPrimPathPattern::FindOrCompile(AttrName);
+    TArray<TPair<pxr::SdfPath, pxr::TfToken>> Matches;
+    for (const TPair<pxr::TfToken, TArray<FIndexedPrim>>& Pair : PrimsByAttribute)
+    {
+        if (!Pattern->MatchesName(Pair.Key))
+        {
+            continue;
+        }
+
+        for (const FIndexedPrim& Prim : Pair.Value)
+        {
+            if (!bCustomOnly || Prim.bCustom)
+            {
+                Matches.Emplace(Prim.Path, Pair.Key);
+            }
+        }
+    }
+
+    // The index isn't ordered by name, so sort to keep the results stable between runs
+    Algo::Sort(Matches, [](const TPair<pxr::SdfPath, pxr::TfToken>& A, const TPair<pxr::SdfPath, pxr::TfToken>& B)
+    {
+        return A.Key == B.Key ? A.Value.GetString() < B.Value.GetString() : A.Key < B.Key;
+    });
+
+    OutPrimPaths.Reserve(OutPrimPaths.Num() + Matches.Num());
+    for (const TPair<pxr::SdfPath, pxr::TfToken>& Match : Matches)
+    {
+        OutPrimPaths.Add(Match.Key);
+        if (OutAttrNames)
+        {
+            OutAttrNames->Add(Match.Value);
+        }
+    }
+}
+
+void FUsdAttributeNameIndex::HandlePrimChanged(const UE::FUsdStage& Stage, const FString& PrimPath, bool bResync)
+{
+    if (!bResync)
+    {
+        return;
+    }
+
+    const pxr::SdfPath ChangedPath(TCHAR_TO_UTF8(*PrimPath));
+    if (ChangedPath.IsEmpty() || ChangedPath.IsAbsoluteRootPath())
+    {
+        Build(Stage);
+        return;
+    }
+
+    // Re-indexed prims are appended, so paths may no longer be in traversal order after an edit
+    const pxr::SdfPath RootPath = ChangedPath.GetPrimPath();
+    RemoveSubtree(RootPath);
+
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+    pxr::UsdPrim RootPrim = UsdStage ? UsdStage->GetPrimAtPath(RootPath) : pxr::UsdPrim();
+    if (!RootPrim || !pxr::UsdPrimDefaultPredicate(RootPrim))
+    {
+        return;
+    }
+
+    TArray<pxr::UsdPrim> Prims;
+    for (const pxr::UsdPrim& Prim : pxr::UsdPrimRange(RootPrim))
+    {
+        Prims.Add(Prim);
+    }
+    IndexPrims(Prims);
+}
+
+SIZE_T FUsdAttributeNameIndex::GetAllocatedSize() const
+{
+    SIZE_T AllocatedSize = PrimsByAttribute.GetAllocatedSize();
+    for (const TPair<pxr::TfToken, TArray<FIndexedPrim>>& Pair : PrimsByAttribute)
+    {
+        AllocatedSize += Pair.Value.GetAllocatedSize();
+    }
+    return AllocatedSize;
+}
+
+void FUsdAttributeNameIndex::Build(const UE::FUsdStage& Stage)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    PrimsByAttribute.Reset();
+    NumAttributes = 0;
+
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+    TArray<pxr::UsdPrim> Prims;
+    if (UsdStage)
+    {
+        // Traverse uses the same predicate as the prim name index, so both see the same prims
+        for (const pxr::UsdPrim& Prim : UsdStage->Traverse())
+        {
+            Prims.Add(Prim);
+        }
+    }
+    IndexPrims(Prims);
+
+    BuildTimeSeconds = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG(LogUsdAttributes, Log, TEXT("Indexed %d authored attributes with %d unique names on %d prims in %.2f ms using %.1f KiB"),
+        NumAttributes, PrimsByAttribute.Num(), Prims.Num(), BuildTimeSeconds * 1000.0, GetAllocatedSize() / 1024.0);
+}
+
+void FUsdAttributeNameIndex::IndexPrims(TArrayView<const pxr::UsdPrim> Prims)
+{
+    using namespace UsdAttributeNameIndexImpl;
+
+    struct FChunkEntry
+    {
+        pxr::TfToken Name;
+        FIndexedPrim Prim;
+    };
+
+    // Reading the authored attributes resolves every property of every prim, which dominates the build,
+    // so it's split across workers. Each chunk fills its own list and the map is only touched when merging
+    const int32 NumChunks = FMath::DivideAndRoundUp(Prims.Num(), ChunkSize);
+    TArray<TArray<FChunkEntry>> Chunks;
+    Chunks.SetNum(NumChunks);
+
+    ParallelFor(NumChunks, [&Prims, &Chunks](int32 Chunk)
+    {
+        const int32 Start = Chunk * ChunkSize;
+        const int32 End = FMath::Min(Start + ChunkSize, Prims.Num());
+        TArray<FChunkEntry>& Entries = Chunks[Chunk];
+
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            const pxr::UsdPrim& Prim = Prims[Index];
+            for (const pxr::UsdAttribute& Attr : Prim.GetAuthoredAttributes())
+            {
+                Entries.Add(FChunkEntry{ Attr.GetName(), FIndexedPrim{ Prim.GetPath(), Attr.IsCustom() } });
+            }
+        }
+    }, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    // Merged in chunk order, so each name's prims stay in traversal order
+    for (TArray<FChunkEntry>& Entries : Chunks)
+    {
+        for (FChunkEntry& Entry : Entries)
+        {
+            PrimsByAttribute.FindOrAdd(Entry.Name).Add(MoveTemp(Entry.Prim));
+        }
+        NumAttributes += Entries.Num();
+    }
+}
+
+void FUsdAttributeNameIndex::RemoveSubtree(const pxr::SdfPath& RootPath)
+{
+    for (auto It = PrimsByAttribute.CreateIterator(); It; ++It)
+    {
+        NumAttributes -= It.Value().RemoveAll([&RootPath](const FIndexedPrim& Prim)
+        {
+            return Prim.Path.HasPrefix(RootPath);
+        });
+
+        if (It.Value().Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+#endif
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeSampler.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/attribute.h"
+#include "USDIncludesEnd.h"
+
+#include <vector>
+
+FUsdAttributeSampler::FUsdAttributeSampler(const pxr::UsdAttributeQuery& InQuery, EUsdAttributeInterpolation InInterpolation)
+    : Query(InQuery)
+    , Interpolation(InInterpolation)
+{
+    for (int32& WindowIndex : WindowIndices)
+    {
+        WindowIndex = INDEX_NONE;
+    }
+
+    if (!Query.IsValid() || !Query.HasValue())
+    {
+        return;
+    }
+
+    bool bCanInterpolate = true;
+    NumComponents = UsdAttributeInterpolation::GetNumComponents(Query.GetAttribute().GetTypeName().GetType(), bCanInterpolate);
+    if (!bCanInterpolate)
+    {
+        Interpolation = EUsdAttributeInterpolation::Held;
+    }
+
+    std::vector<double> TimeSamples;
+    if (Query.GetTimeSamples(&TimeSamples) && !TimeSamples.empty())
+    {
+        Times.Append(TimeSamples.data(), static_cast<int32>(TimeSamples.size()));
+    }
+    else
+    {
+        // Held everywhere, read once from the default value
+        Times.Add(0.0);
+        bDefaultValueOnly = true;
+    }
+}
+
+bool FUsdAttributeSampler::Sample(double Time, double* OutComponents)
+{
+    if (!IsValid())
+    {
+        return false;
+    }
+
+    const int32 NumSamples = Times.Num();
+    const int32 Index = Cursor.FindBracket(Times, Time);
+
+    // Cubic interpolation needs the samples either side of the bracket for its tangents
+    const bool bNeedsTangents = Interpolation == EUsdAttributeInterpolation::Cubic;
+    const double* const Neighbours[4] =
+    {
+        bNeedsTangents && Index > 0 ? GetSampleValues(Index - 1) : nullptr,
+        GetSampleValues(Index),
+        Index + 1 < NumSamples ? GetSampleValues(Index + 1) : nullptr,
+        bNeedsTangents && Index + 2 < NumSamples ? GetSampleValues(Index + 2) : nullptr
+    };
+
+    UsdAttributeInterpolation::Evaluate(Interpolation, Times, Index, Time, Neighbours, NumComponents, OutComponents);
+    return true;
+}
+
+const double* FUsdAttributeSampler::GetSampleValues(int32 SampleIndex)
+{
+    const int32 Slot = SampleIndex % WindowSize;
+    double* Values = WindowValues[Slot];
+    if (WindowIndices[Slot] == SampleIndex)
+    {
+        return Values;
+    }
+
+    pxr::VtValue Value;
+    const pxr::UsdTimeCode TimeCode = bDefaultValueOnly ? pxr::UsdTimeCode::Default() : pxr::UsdTimeCode(Times[SampleIndex]);
+    if (!Query.Get(&Value, TimeCode) || !UsdAttributeInterpolation::ReadComponents(Value, Values))
+    {
+        FMemory::Memzero(Values, sizeof(WindowValues[Slot]));
+    }
+
+    WindowIndices[Slot] = SampleIndex;
+    return Values;
+}
+#endif
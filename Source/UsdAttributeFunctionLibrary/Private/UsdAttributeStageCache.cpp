@@ -0,0 +1,438 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeStageCache.h"
+#include "UsdAttributeFunctionLibrary.h"
+#include "UsdAttributeStats.h"
+#include "UsdPrimPathPattern.h"
+#include "UsdStageActorEventBinding.h"
+
+#if USE_USD_SDK
+#include "USDStageActor.h"
+#include "UObject/ObjectKey.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/stage.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdAttributeStageCacheImpl
+{
+    /** The cache for a single stage actor along with the event bindings that keep it up to date. */
+    struct FRegistryEntry
+    {
+        FUsdStageActorEventBinding Events;
+        TSharedPtr<FUsdAttributeStageCache> Cache;
+    };
+
+    TMap<TObjectKey<AUsdStageActor>, FRegistryEntry>& GetRegistry()
+    {
+        static TMap<TObjectKey<AUsdStageActor>, FRegistryEntry> Registry;
+        return Registry;
+    }
+
+    /**
+     * @brief Binds to the stage actor's events so the cache follows stage reloads and prim edits.
+     *
+     * @param StageActor The stage actor owning the cache.
+     * @param Entry The registry entry to bind.
+     */
+    void BindStageActorEvents(AUsdStageActor* StageActor, FRegistryEntry& Entry)
+    {
+        const TObjectKey<AUsdStageActor> Key(StageActor);
+
+        FUsdStageActorEventBinding::FHandlers Handlers;
+
+        // A new stage has been opened (or the current one closed), so rebuild straight away
+        Handlers.OnStageChanged = [Key]()
+        {
+            if (FRegistryEntry* Found = GetRegistry().Find(Key))
+            {
+                AUsdStageActor* Actor = Found->Events.GetStageActor();
+                UE::FUsdStage Stage = Actor ? Actor->GetUsdStage() : UE::FUsdStage();
+                Found->Cache = Stage ? MakeShared<FUsdAttributeStageCache>(Stage) : nullptr;
+            }
+        };
+
+        Handlers.OnPrimChanged = [Key](const FString& PrimPath, bool bResync)
+        {
+            if (FRegistryEntry* Found = GetRegistry().Find(Key))
+            {
+                if (Found->Cache)
+                {
+                    Found->Cache->HandlePrimChanged(PrimPath, bResync);
+                }
+            }
+        };
+
+        Handlers.OnActorDestroyed = [Key]()
+        {
+            GetRegistry().Remove(Key);
+        };
+
+        Entry.Events.Bind(StageActor, MoveTemp(Handlers));
+    }
+}
+
+TSharedPtr<FUsdAttributeStageCache> FUsdAttributeStageCache::FindOrCreate(AUsdStageActor* StageActor)
+{
+    using namespace UsdAttributeStageCacheImpl;
+
+    if (!StageActor)
+    {
+        return nullptr;
+    }
+
+    UE::FUsdStage CurrentStage = StageActor->GetUsdStage();
+    if (!CurrentStage)
+    {
+        return nullptr;
+    }
+
+    FRegistryEntry& Entry = GetRegistry().FindOrAdd(TObjectKey<AUsdStageActor>(StageActor));
+    if (!Entry.Events.IsBound())
+    {
+        BindStageActorEvents(StageActor, Entry);
+    }
+
+    // The stage may have been swapped without an event reaching us, e.g. before the entry was created
+    if (!Entry.Cache || !Entry.Cache->IsForStage(CurrentStage))
+    {
+        Entry.Cache = MakeShared<FUsdAttributeStageCache>(CurrentStage);
+    }
+
+    return Entry.Cache;
+}
+
+void FUsdAttributeStageCache::ResetAll()
+{
+    using namespace UsdAttributeStageCacheImpl;
+
+    for (TPair<TObjectKey<AUsdStageActor>, FRegistryEntry>& Pair : GetRegistry())
+    {
+        Pair.Value.Events.Unbind();
+    }
+
+    GetRegistry().Empty();
+}
+
+FUsdAttributeStageCache::FUsdAttributeStageCache(const UE::FUsdStage& InStage)
+    : Stage(InStage)
+{
+}
+
+const FUsdPrimNameIndex& FUsdAttributeStageCache::GetNameIndex() const
+{
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (NameIndex)
+        {
+            return *NameIndex;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    if (!NameIndex)
+    {
+        NameIndex = MakeUnique<FUsdPrimNameIndex>(Stage);
+    }
+    return *NameIndex;
+}
+
+const FUsdAttributeNameIndex& FUsdAttributeStageCache::GetAttributeNameIndex() const
+{
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (AttributeNameIndex)
+        {
+            return *AttributeNameIndex;
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+    if (!AttributeNameIndex)
+    {
+        AttributeNameIndex = MakeUnique<FUsdAttributeNameIndex>(Stage);
+    }
+    return *AttributeNameIndex;
+}
+
+pxr::UsdPrim FUsdAttributeStageCache::FindPrim(const FString& PrimName) const
+{
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+    pxr::SdfPath PrimPath;
+
+    if (FUsdPrimPathPattern::Classify(PrimName) == FUsdPrimPathPattern::EKind::Name)
+    {
+        const FUsdPrimNameIndex& Index = GetNameIndex();
+
+        FReadScopeLock ReadLock(Lock);
+        const TArray<pxr::SdfPath>* Paths = Index.FindPrimPaths(PrimName);
+        if (!Paths)
+        {
+            return pxr::UsdPrim();
+        }
+        PrimPath = (*Paths)[0];
+    }
+    else
+    {
+        TArray<pxr::SdfPath> Paths;
+        FindPrimPaths(PrimName, Paths, true);
+        if (Paths.IsEmpty())
+        {
+            return pxr::UsdPrim();
+        }
+        PrimPath = Paths[0];
+    }
+
+    return UsdStage->GetPrimAtPath(PrimPath);
+}
+
+void FUsdAttributeStageCache::FindPrimPaths(const FString& PrimName, TArray<pxr::SdfPath>& OutPaths, bool bFirstOnly) const
+{
+    const FUsdPrimPathPattern::EKind Kind = FUsdPrimPathPattern::Classify(PrimName);
+    if (Kind == FUsdPrimPathPattern::EKind::Name)
+    {
+        const FUsdPrimNameIndex& Index = GetNameIndex();
+
+        FReadScopeLock ReadLock(Lock);
+        if (const TArray<pxr::SdfPath>* Paths = Index.FindPrimPaths(PrimName))
+        {
+            OutPaths.Append(bFirstOnly ? MakeArrayView(Paths->GetData(), 1) : MakeArrayView(*Paths));
+        }
+        return;
+    }
+
+    TSharedRef<const FUsdPrimPathPattern> Pattern = FUsdPrimPathPattern::FindOrCompile(PrimName);
+    if (Kind == FUsdPrimPathPattern::EKind::NameWildcard)
+    {
+        const FUsdPrimNameIndex& Index = GetNameIndex();
+
+        const int32 FirstNew = OutPaths.Num();
+        {
+            FReadScopeLock ReadLock(Lock);
+            Index.FindPrimPathsMatching(Stage, [&Pattern](const pxr::TfToken& Name) { return Pattern->MatchesName(Name); }, OutPaths);
+        }
+
+        // The matches come back in traversal order, so the first is the one a stage traversal would find
+        if (bFirstOnly && OutPaths.Num() - FirstNew > 1)
+        {
+            OutPaths.SetNum(FirstNew + 1);
+        }
+        return;
+    }
+
+    Pattern->FindMatches(pxr::UsdStageRefPtr{ Stage }, OutPaths, bFirstOnly);
+}
+
+void FUsdAttributeStageCache::FindPrimPathsWithAttribute(const FString& AttrName, bool bCustomOnly, TArray<pxr::SdfPath>& OutPrimPaths, TArray<pxr::TfToken>* OutAttrNames) const
+{
+    const FUsdAttributeNameIndex& Index = GetAttributeNameIndex();
+
+    FReadScopeLock ReadLock(Lock);
+    Index.FindPrimPaths(AttrName, bCustomOnly, OutPrimPaths, OutAttrNames);
+}
+
+pxr::UsdAttributeQuery FUsdAttributeStageCache::FindOrCreateAttributeQuery(const FString& PrimName, const FString& AttrName)
+{
+    pxr::UsdAttributeQuery Query = FindAttributeQuery(PrimName, AttrName);
+    if (Query.IsValid())
+    {
+        return Query;
+    }
+
+    return CreateAttributeQuery(FindPrim(PrimName), PrimName, AttrName);
+}
+
+pxr::UsdAttributeQuery FUsdAttributeStageCache::FindAttributeQuery(const FString& PrimName, const FString& AttrName) const
+{
+    FReadScopeLock ReadLock(Lock);
+    if (const pxr::UsdAttributeQuery* CachedQuery = AttributeQueries.Find(FUsdAttributeCacheKey{ PrimName, AttrName }))
+    {
+        USD_ATTRIBUTE_INC_COUNTER(QueryCacheHits);
+        return *CachedQuery;
+    }
+    return pxr::UsdAttributeQuery();
+}
+
+pxr::UsdAttributeQuery FUsdAttributeStageCache::CreateAttributeQuery(const pxr::UsdPrim& Prim, const FString& PrimName, const FString& AttrName)
+{
+    USD_ATTRIBUTE_INC_COUNTER(QueryCacheMisses);
+
+    if (!Prim)
+    {
+        return pxr::UsdAttributeQuery();
+    }
+
+    pxr::UsdAttribute Attr = Prim.GetAttribute(pxr::TfToken(TCHAR_TO_UTF8(*AttrName)));
+    if (!Attr)
+    {
+        return pxr::UsdAttributeQuery();
+    }
+
+    // Resolve outside the lock, another thread may cache the same attribute meanwhile in which case theirs is kept.
+    // Misses aren't cached, as the prim or attribute may be authored later without a resync of this entry
+    pxr::UsdAttributeQuery Query(Attr);
+    FUsdAttributeCacheKey Key{ PrimName, AttrName };
+
+    FWriteScopeLock WriteLock(Lock);
+    if (const pxr::UsdAttributeQuery* CachedQuery = AttributeQueries.Find(Key))
+    {
+        return *CachedQuery;
+    }
+    return AttributeQueries.Add(MoveTemp(Key), MoveTemp(Query));
+}
+
+void FUsdAttributeStageCache::HandlePrimChanged(const FString& PrimPath, bool bResync)
+{
+    FWriteScopeLock WorkerWriteLock(WorkerLock);
+
+    const pxr::SdfPath ChangedPath = pxr::SdfPath(TCHAR_TO_UTF8(*PrimPath)).GetPrimPath();
+
+    // Drops everything cached for an attribute, baked curves are only rebuilt on request so say when one goes
+    auto RemoveCachedAttribute = [this, &PrimPath](const FUsdAttributeCacheKey& Key)
+    {
+        if (BakedCurves.Remove(Key) > 0)
+        {
+            UE_LOG(LogUsdAttributes, Log, TEXT("Dropped the baked curve of Attribute: %s on Prim: %s after a change to %s, bake it again to keep reading it baked"), *Key.AttrName, *Key.PrimName, *PrimPath);
+        }
+        Samplers.Remove(Key);
+    };
+
+    // Queries outside the changed subtree that a resync could still have redirected to another prim
+    TArray<TPair<FUsdAttributeCacheKey, pxr::SdfPath>> ResolvedElsewhere;
+    {
+        FWriteScopeLock WriteLock(Lock);
+
+        // An index that hasn't been built yet will see the change when it is
+        if (NameIndex)
+        {
+            NameIndex->HandlePrimChanged(Stage, PrimPath, bResync);
+        }
+        if (AttributeNameIndex)
+        {
+            AttributeNameIndex->HandlePrimChanged(Stage, PrimPath, bResync);
+        }
+
+        for (auto It = AttributeQueries.CreateIterator(); It; ++It)
+        {
+            const pxr::SdfPath QueryPrimPath = It.Value().GetAttribute().GetPrimPath();
+            if (QueryPrimPath.HasPrefix(ChangedPath))
+            {
+                RemoveCachedAttribute(It.Key());
+                It.RemoveCurrent();
+            }
+            else if (bResync && FUsdPrimPathPattern::Classify(It.Key().PrimName) != FUsdPrimPathPattern::EKind::Path)
+            {
+                ResolvedElsewhere.Emplace(It.Key(), QueryPrimPath);
+            }
+        }
+    }
+
+    // A resync can add or remove a prim that a name now resolves to first, e.g. an earlier prim with the same name.
+    // Resolve those again (FindPrim takes the lock itself) and only drop the ones that moved
+    for (const TPair<FUsdAttributeCacheKey, pxr::SdfPath>& Resolved : ResolvedElsewhere)
+    {
+        if (FindPrim(Resolved.Key.PrimName).GetPath() != Resolved.Value)
+        {
+            FWriteScopeLock WriteLock(Lock);
+            RemoveCachedAttribute(Resolved.Key);
+            AttributeQueries.Remove(Resolved.Key);
+        }
+    }
+}
+
+void FUsdAttributeStageCache::SetInterpolation(const FString& PrimName, const FString& AttrName, TOptional<EUsdAttributeInterpolation> Interpolation)
+{
+    FUsdAttributeCacheKey Key{ PrimName, AttrName };
+    Samplers.Remove(Key);
+
+    if (Interpolation.IsSet())
+    {
+        Interpolations.Add(MoveTemp(Key), Interpolation.GetValue());
+    }
+    else
+    {
+        Interpolations.Remove(Key);
+    }
+}
+
+FUsdAttributeSampler* FUsdAttributeStageCache::FindOrCreateSampler(const pxr::UsdAttributeQuery& Query, const FString& PrimName, const FString& AttrName)
+{
+    if (Interpolations.IsEmpty() || !Query.IsValid())
+    {
+        return nullptr;
+    }
+
+    FUsdAttributeCacheKey Key{ PrimName, AttrName };
+    if (FUsdAttributeSampler* Sampler = Samplers.Find(Key))
+    {
+        return Sampler;
+    }
+
+    const EUsdAttributeInterpolation* Interpolation = Interpolations.Find(Key);
+    if (!Interpolation)
+    {
+        return nullptr;
+    }
+
+    // Only kept while the query is cached, so that edits to the prim drop the sampler along with it
+    FUsdAttributeSampler Sampler(Query, *Interpolation);
+    if (!Sampler.IsValid())
+    {
+        return nullptr;
+    }
+    return &Samplers.Add(MoveTemp(Key), MoveTemp(Sampler));
+}
+
+bool FUsdAttributeStageCache::BakeCurve(const FString& PrimName, const FString& AttrName, EUsdAttributeInterpolation Interpolation)
+{
+    pxr::UsdAttributeQuery Query = FindOrCreateAttributeQuery(PrimName, AttrName);
+    if (!Query.IsValid())
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Unable to bake curve, no Attribute found with name: %s on Prim: %s"), *AttrName, *PrimName);
+        return false;
+    }
+
+    std::vector<double> TimeSamples;
+    if (!Query.GetTimeSamples(&TimeSamples) || TimeSamples.empty())
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Unable to bake curve, Attribute: %s on Prim: %s has no time samples"), *AttrName, *PrimName);
+        return false;
+    }
+
+    FUsdBakedAttributeCurve Curve;
+    Curve.Interpolation = Interpolation;
+    Curve.Times.Append(TimeSamples.data(), static_cast<int32>(TimeSamples.size()));
+
+    // Pick the layout from the value type, assuming every sample holds the same type
+    bool bCanInterpolate = true;
+    Curve.NumComponents = UsdAttributeInterpolation::GetNumComponents(Query.GetAttribute().GetTypeName().GetType(), bCanInterpolate);
+    if (Curve.NumComponents == 0)
+    {
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Unable to bake curve, Attribute: %s on Prim: %s has an unsupported type"), *AttrName, *PrimName);
+        return false;
+    }
+    if (!bCanInterpolate)
+    {
+        Curve.Interpolation = EUsdAttributeInterpolation::Held;
+    }
+
+    Curve.Values.SetNumZeroed(Curve.Times.Num() * Curve.NumComponents);
+
+    pxr::VtValue Value;
+    double* OutValue = Curve.Values.GetData();
+    for (double Time : TimeSamples)
+    {
+        if (Query.Get(&Value, pxr::UsdTimeCode(Time)))
+        {
+            UsdAttributeInterpolation::ReadComponents(Value, OutValue);
+        }
+        OutValue += Curve.NumComponents;
+    }
+
+    UE_LOG(LogUsdAttributes, Log, TEXT("Baked %d samples of Attribute: %s on Prim: %s (%.1f KiB)"), Curve.Times.Num(), *AttrName, *PrimName, Curve.GetAllocatedSize() / 1024.0);
+
+    BakedCurves.Add(FUsdAttributeCacheKey{ PrimName, AttrName }, MoveTemp(Curve));
+    return true;
+}
+#endif
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeStats.h"
+
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_UsdAttributes_Vec3);
+DEFINE_STAT(STAT_UsdAttributes_Float);
+DEFINE_STAT(STAT_UsdAttributes_Double);
+DEFINE_STAT(STAT_UsdAttributes_Int);
+DEFINE_STAT(STAT_UsdAttributes_AnimatedVec3);
+DEFINE_STAT(STAT_UsdAttributes_AnimatedFloat);
+DEFINE_STAT(STAT_UsdAttributes_AnimatedDouble);
+DEFINE_STAT(STAT_UsdAttributes_AnimatedInt);
+DEFINE_STAT(STAT_UsdAttributes_Other);
+DEFINE_STAT(STAT_UsdAttributes_AnimatedOther);
+DEFINE_STAT(STAT_UsdAttributes_Array);
+DEFINE_STAT(STAT_UsdAttributes_Batch);
+DEFINE_STAT(STAT_UsdAttributes_Range);
+DEFINE_STAT(STAT_UsdAttributes_Bindings);
+
+DEFINE_STAT(STAT_UsdAttributes_LookupMisses);
+DEFINE_STAT(STAT_UsdAttributes_QueryCacheHits);
+DEFINE_STAT(STAT_UsdAttributes_QueryCacheMisses);
+DEFINE_STAT(STAT_UsdAttributes_BakedCurveReads);
+DEFINE_STAT(STAT_UsdAttributes_SamplerReads);
+
+namespace UsdAttributeStatsImpl
+{
+    const TCHAR* GetterNames[] =
+    {
+        TEXT("GetUsdVec3Attribute"),
+        TEXT("GetUsdFloatAttribute"),
+        TEXT("GetUsdDoubleAttribute"),
+        TEXT("GetUsdIntAttribute"),
+        TEXT("GetUsdAnimatedVec3Attribute"),
+        TEXT("GetUsdAnimatedFloatAttribute"),
+        TEXT("GetUsdAnimatedDoubleAttribute"),
+        TEXT("GetUsdAnimatedIntAttribute"),
+        TEXT("GetUsd...Attribute (other types)"),
+        TEXT("GetUsdAnimated...Attribute (other types)"),
+        TEXT("GetUsd...ArrayAttribute"),
+        TEXT("GetUsdAttributesBatch"),
+        TEXT("GetUsdAnimatedAttributeRange"),
+        TEXT("UsdAttributeBindings"),
+    };
+    static_assert(UE_ARRAY_COUNT(GetterNames) == static_cast<int32>(EUsdAttributeGetter::Num), "Every getter needs a name");
+
+    FAutoConsoleCommandWithOutputDevice DumpStatsCommand(
+        TEXT("UsdAttributes.DumpStats"),
+        TEXT("Dumps call counts, latency percentiles and cache hit rates for the Usd attribute getters"),
+        FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+        {
+            FUsdAttributeStats::Get().Dump(Ar);
+        }));
+
+    FAutoConsoleCommand ResetStatsCommand(
+        TEXT("UsdAttributes.ResetStats"),
+        TEXT("Clears the statistics reported by UsdAttributes.DumpStats"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FUsdAttributeStats::Get().Reset();
+        }));
+}
+
+FUsdAttributeStats& FUsdAttributeStats::Get()
+{
+    static FUsdAttributeStats Stats;
+    return Stats;
+}
+
+void FUsdAttributeStats::RecordCall(EUsdAttributeGetter Getter, uint64 Cycles)
+{
+    FGetterStats& Stats = Getters[static_cast<int32>(Getter)];
+
+    const uint64 Nanoseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(Cycles) * 1e9);
+    const int32 Bucket = FMath::Min(static_cast<int32>(FMath::FloorLog2_64(Nanoseconds)), NumBuckets - 1);
+
+    Stats.Calls.fetch_add(1, std::memory_order_relaxed);
+    Stats.TotalCycles.fetch_add(Cycles, std::memory_order_relaxed);
+    Stats.Buckets[Bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+double FUsdAttributeStats::GetPercentileNanoseconds(const FGetterStats& Stats, double Fraction)
+{
+    const uint64 Calls = Stats.Calls.load(std::memory_order_relaxed);
+    const uint64 Target = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Calls * Fraction)));
+
+    uint64 Cumulative = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Cumulative += Stats.Buckets[Bucket].load(std::memory_order_relaxed);
+        if (Cumulative >= Target)
+        {
+            return static_cast<double>(uint64(1) << (Bucket + 1));
+        }
+    }
+    return static_cast<double>(uint64(1) << NumBuckets);
+}
+
+void FUsdAttributeStats::Dump(FOutputDevice& Ar) const
+{
+    using namespace UsdAttributeStatsImpl;
+
+    Ar.Logf(TEXT("%-32s %12s %12s %12s %12s %12s %12s"), TEXT("Getter"), TEXT("Calls"), TEXT("Total ms"), TEXT("Avg ns"), TEXT("p50 ns"), TEXT("p90 ns"), TEXT("p99 ns"));
+
+    for (int32 Index = 0; Index < static_cast<int32>(EUsdAttributeGetter::Num); ++Index)
+    {
+        const FGetterStats& Stats = Getters[Index];
+        const uint64 Calls = Stats.Calls.load(std::memory_order_relaxed);
+        if (Calls == 0)
+        {
+            continue;
+        }
+
+        const double TotalSeconds = FPlatformTime::ToSeconds64(Stats.TotalCycles.load(std::memory_order_relaxed));
+        Ar.Logf(TEXT("%-32s %12llu %12.3f %12.0f %12.0f %12.0f %12.0f"),
+            GetterNames[Index],
+            Calls,
+            TotalSeconds * 1e3,
+            TotalSeconds * 1e9 / Calls,
+            GetPercentileNanoseconds(Stats, 0.5),
+            GetPercentileNanoseconds(Stats, 0.9),
+            GetPercentileNanoseconds(Stats, 0.99));
+    }
+
+    const uint64 LookupMisses = Counters[static_cast<int32>(EUsdAttributeCounter::LookupMisses)].load(std::memory_order_relaxed);
+    const uint64 QueryHits = Counters[static_cast<int32>(EUsdAttributeCounter::QueryCacheHits)].load(std::memory_order_relaxed);
+    const uint64 QueryMisses = Counters[static_cast<int32>(EUsdAttributeCounter::QueryCacheMisses)].load(std::memory_order_relaxed);
+    const uint64 BakedReads = Counters[static_cast<int32>(EUsdAttributeCounter::BakedCurveReads)].load(std::memory_order_relaxed);
+    const uint64 SamplerReads = Counters[static_cast<int32>(EUsdAttributeCounter::SamplerReads)].load(std::memory_order_relaxed);
+    const uint64 QueryLookups = QueryHits + QueryMisses;
+
+    Ar.Logf(TEXT("Lookup misses: %llu"), LookupMisses);
+    Ar.Logf(TEXT("Query cache: %llu hits, %llu misses (%.1f%% hit rate)"), QueryHits, QueryMisses, QueryLookups > 0 ? 100.0 * QueryHits / QueryLookups : 0.0);
+    Ar.Logf(TEXT("Baked curve reads: %llu"), BakedReads);
+    Ar.Logf(TEXT("Sampler reads: %llu"), SamplerReads);
+}
+
+void FUsdAttributeStats::Reset()
+{
+    for (FGetterStats& Stats : Getters)
+    {
+        Stats.Calls.store(0, std::memory_order_relaxed);
+        Stats.TotalCycles.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64>& Bucket : Stats.Buckets)
+        {
+            Bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    for (std::atomic<uint64>& Counter : Counters)
+    {
+        Counter.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,482 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdAttributeSubscriptions.h"
+#include "UsdAttributeStageCache.h"
+#include "UsdStageActorEventBinding.h"
+
+#if USE_USD_SDK
+#include "Algo/AnyOf.h"
+#include "Algo/BinarySearch.h"
+#include "Containers/Ticker.h"
+#include "Math/Range.h"
+#include "USDStageActor.h"
+#include "UObject/ObjectKey.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/attributeQuery.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/usd/usd/stage.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdAttributeSubscriptionsImpl
+{
+    /** A single subscriber along with the last value it was called with. */
+    struct FSubscription
+    {
+        TObjectKey<AUsdStageActor> StageKey;
+        FString PrimName;
+        FString AttrName;
+        FOnUsdAttributeChanged OnChanged;
+
+        pxr::UsdAttributeQuery Query;
+        pxr::VtValue Value;
+
+        /** The attribute's time samples, read when the query is resolved. */
+        TArray<double> TimeSamples;
+
+        /** Whether values are held between time samples rather than linearly interpolated. */
+        bool bHeld = false;
+
+        /** The times around the last read over which the value is known not to change. */
+        TRange<double> ConstantRange = TRange<double>::Empty();
+
+        /** Set when the stage was edited, so the query has to be resolved and the value read again. */
+        bool bDirty = true;
+    };
+
+    /** The subscriptions on one stage actor along with the event bindings that keep them up to date. */
+    struct FStageEntry
+    {
+        FUsdStageActorEventBinding Events;
+        TArray<int64> SubscriptionIds;
+    };
+
+    struct FState
+    {
+        TMap<int64, FSubscription> Subscriptions;
+        TMap<TObjectKey<AUsdStageActor>, FStageEntry> Stages;
+        int64 NextId = 1;
+
+        /** Set while a tick is pending to read the subscriptions dirtied by stage edits. */
+        FTSTicker::FDelegateHandle PendingTickHandle;
+    };
+
+    FState& GetState()
+    {
+        static FState State;
+        return State;
+    }
+
+    /** A value to send to a subscriber once the subscriptions are no longer being iterated. */
+    using FNotification = TPair<int64, pxr::VtValue>;
+
+    /**
+     * @brief Finds the times around Time over which an attribute resolves to the same value.
+     *
+     * Starts from the samples bracketing Time and extends across neighbouring samples holding the same
+     * value, so that an attribute keyed on every frame but rarely changing isn't read on every frame.
+     *
+     * @param Query The attribute's query.
+     * @param Times The attribute's time samples, in increasing order.
+     * @param bHeld Whether values are held between samples rather than linearly interpolated.
+     * @param Time The time the value was read at.
+     * @return The range, which only contains Time itself where the value may change either side of it.
+     */
+    TRange<double> ComputeConstantRange(const pxr::UsdAttributeQuery& Query, TArrayView<const double> Times, bool bHeld, double Time)
+    {
+        if (Times.Num() < 2)
+        {
+            return TRange<double>::All();
+        }
+
+        auto GetSampleValue = [&Query, &Times](int32 SampleIndex)
+        {
+            pxr::VtValue Value;
+            Query.Get(&Value, pxr::UsdTimeCode(Times[SampleIndex]));
+            return Value;
+        };
+
+        // The last sample at or before Time, clamped to the first sample as its value is held before it
+        const int32 Index = FMath::Max(Algo::UpperBound(Times, Time) - 1, 0);
+
+        // The first and last samples of the run holding the value read at Time
+        int32 First = Index;
+        int32 Last = Index;
+        const pxr::VtValue Value = GetSampleValue(Index);
+
+        // Between two samples a linearly interpolated value only stays constant if they're equal
+        if (!bHeld && Time > Times[Index] && Index + 1 < Times.Num())
+        {
+            if (GetSampleValue(Index + 1) != Value)
+            {
+                return TRange<double>::Inclusive(Time, Time);
+            }
+            Last = Index + 1;
+        }
+
+        while (Last + 1 < Times.Num() && GetSampleValue(Last + 1) == Value)
+        {
+            ++Last;
+        }
+        while (First > 0 && GetSampleValue(First - 1) == Value)
+        {
+            --First;
+        }
+
+        // Values are held before the first and after the last sample
+        const TRangeBound<double> LowerBound = First == 0 ? TRangeBound<double>::Open() : TRangeBound<double>::Inclusive(Times[First]);
+        if (Last + 1 == Times.Num())
+        {
+            return TRange<double>(LowerBound, TRangeBound<double>::Open());
+        }
+
+        // A held value changes at the next sample, an interpolated one as soon as it leaves the last equal sample
+        return TRange<double>(LowerBound, bHeld ? TRangeBound<double>::Exclusive(Times[Last + 1]) : TRangeBound<double>::Inclusive(Times[Last]));
+    }
+
+    /**
+     * @brief Whether Usd linearly interpolates values of a type between time samples.
+     *
+     * Only floating point scalars, vectors, quaternions and matrices, and arrays of them, are interpolated.
+     * Values of every other type, e.g. bools, ints, tokens and strings, are held whatever the stage's
+     * interpolation type.
+     */
+    bool IsInterpolatable(const pxr::SdfValueTypeName& TypeName)
+    {
+        static const pxr::TfType InterpolatableTypes[] =
+        {
+            pxr::SdfValueTypeNames->Half.GetType(), pxr::SdfValueTypeNames->Float.GetType(), pxr::SdfValueTypeNames->Double.GetType(),
+            pxr::SdfValueTypeNames->TimeCode.GetType(),
+            pxr::SdfValueTypeNames->Half2.GetType(), pxr::SdfValueTypeNames->Float2.GetType(), pxr::SdfValueTypeNames->Double2.GetType(),
+            pxr::SdfValueTypeNames->Half3.GetType(), pxr::SdfValueTypeNames->Float3.GetType(), pxr::SdfValueTypeNames->Double3.GetType(),
+            pxr::SdfValueTypeNames->Half4.GetType(), pxr::SdfValueTypeNames->Float4.GetType(), pxr::SdfValueTypeNames->Double4.GetType(),
+            pxr::SdfValueTypeNames->Quath.GetType(), pxr::SdfValueTypeNames->Quatf.GetType(), pxr::SdfValueTypeNames->Quatd.GetType(),
+            pxr::SdfValueTypeNames->Matrix2d.GetType(), pxr::SdfValueTypeNames->Matrix3d.GetType(), pxr::SdfValueTypeNames->Matrix4d.GetType()
+        };
+
+        // Roles such as Color3f or Point3f share the type of the plain vector
+        const pxr::TfType ScalarType = TypeName.GetScalarType().GetType();
+        return Algo::AnyOf(InterpolatableTypes, [&ScalarType](const pxr::TfType& Type) { return Type == ScalarType; });
+    }
+
+    /**
+     * @brief Reads the time samples of a subscription's attribute and how its values are interpolated.
+     *
+     * @param Subscription The subscription, whose query has just been resolved.
+     */
+    void ReadTimeSamples(FSubscription& Subscription)
+    {
+        Subscription.TimeSamples.Reset();
+        Subscription.bHeld = false;
+
+        std::vector<double> Times;
+        if (!Subscription.Query.IsValid() || !Subscription.Query.ValueMightBeTimeVarying() || !Subscription.Query.GetTimeSamples(&Times))
+        {
+            return;
+        }
+        Subscription.TimeSamples.Append(Times.data(), static_cast<int32>(Times.size()));
+
+        const pxr::UsdAttribute Attr = Subscription.Query.GetAttribute();
+        pxr::UsdStageWeakPtr UsdStage = Attr.GetStage();
+        Subscription.bHeld = !IsInterpolatable(Attr.GetTypeName())
+            || (UsdStage && UsdStage->GetInterpolationType() == pxr::UsdInterpolationTypeHeld);
+    }
+
+    /**
+     * @brief Reads a subscription's value, queueing a notification if it changed since the last read.
+     *
+     * @param Subscription The subscription to read.
+     * @param Id The subscription's id.
+     * @param StageActor The stage actor the subscription was made on.
+     * @param OutNotifications Receives the new value if it changed.
+     */
+    void Evaluate(FSubscription& Subscription, int64 Id, AUsdStageActor& StageActor, TArray<FNotification>& OutNotifications)
+    {
+        if (Subscription.bDirty)
+        {
+            TSharedPtr<FUsdAttributeStageCache> Cache = FUsdAttributeStageCache::FindOrCreate(&StageActor);
+            Subscription.Query = Cache ? Cache->FindOrCreateAttributeQuery(Subscription.PrimName, Subscription.AttrName) : pxr::UsdAttributeQuery();
+            Subscription.bDirty = false;
+            ReadTimeSamples(Subscription);
+        }
+
+        pxr::VtValue Value;
+        if (Subscription.Query.IsValid())
+        {
+            const double Time = StageActor.GetTime();
+            Subscription.Query.Get(&Value, pxr::UsdTimeCode(Time));
+            Subscription.ConstantRange = ComputeConstantRange(Subscription.Query, Subscription.TimeSamples, Subscription.bHeld, Time);
+        }
+        else
+        {
+            // Only a stage edit can author the missing prim or attribute
+            Subscription.ConstantRange = TRange<double>::All();
+        }
+
+        if (Value.IsEmpty() == Subscription.Value.IsEmpty() && (Value.IsEmpty() || Value == Subscription.Value))
+        {
+            return;
+        }
+
+        Subscription.Value = Value;
+        OutNotifications.Emplace(Id, MoveTemp(Value));
+    }
+
+    /** Removes the subscriptions of a stage entry and unbinds it from the stage actor's events. */
+    void RemoveStageEntry(const TObjectKey<AUsdStageActor>& Key)
+    {
+        FState& State = GetState();
+        FStageEntry Entry;
+        if (!State.Stages.RemoveAndCopyValue(Key, Entry))
+        {
+            return;
+        }
+
+        for (int64 Id : Entry.SubscriptionIds)
+        {
+            State.Subscriptions.Remove(Id);
+        }
+
+        Entry.Events.Unbind();
+    }
+
+    /** Removes a single subscription, dropping its stage entry if it was the last one. */
+    void RemoveSubscription(int64 Id)
+    {
+        FState& State = GetState();
+        FSubscription Subscription;
+        if (!State.Subscriptions.RemoveAndCopyValue(Id, Subscription))
+        {
+            return;
+        }
+
+        if (FStageEntry* Entry = State.Stages.Find(Subscription.StageKey))
+        {
+            Entry->SubscriptionIds.RemoveSingleSwap(Id);
+            if (Entry->SubscriptionIds.IsEmpty())
+            {
+                RemoveStageEntry(Subscription.StageKey);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls the subscribers with their new values.
+     *
+     * Subscribers may subscribe or unsubscribe from their callback, so each subscription is looked up again before it is called.
+     */
+    void Notify(TArray<FNotification>& Notifications)
+    {
+        for (FNotification& Notification : Notifications)
+        {
+            FSubscription* Subscription = GetState().Subscriptions.Find(Notification.Key);
+            if (!Subscription)
+            {
+                continue;
+            }
+
+            if (!Subscription->OnChanged.IsBound())
+            {
+                RemoveSubscription(Notification.Key);
+                continue;
+            }
+
+            // Copied, as the callback may remove the subscription
+            FOnUsdAttributeChanged OnChanged = Subscription->OnChanged;
+            OnChanged.Execute(Notification.Value);
+        }
+    }
+
+    /**
+     * @brief Reads every subscription on a stage actor that may have changed.
+     *
+     * @param Key The stage actor.
+     * @param bOnlyDirty Whether to only read the subscriptions dirtied by stage edits, otherwise those whose constant range doesn't contain the current time are read as well.
+     * @param OutNotifications Receives the values that changed.
+     */
+    void EvaluateStage(const TObjectKey<AUsdStageActor>& Key, bool bOnlyDirty, TArray<FNotification>& OutNotifications)
+    {
+        FState& State = GetState();
+        FStageEntry* Entry = State.Stages.Find(Key);
+        AUsdStageActor* StageActor = Entry ? Entry->Events.GetStageActor() : nullptr;
+        if (!StageActor)
+        {
+            return;
+        }
+
+        const double Time = StageActor->GetTime();
+        for (int64 Id : Entry->SubscriptionIds)
+        {
+            FSubscription& Subscription = State.Subscriptions.FindChecked(Id);
+            if (Subscription.bDirty || (!bOnlyDirty && !Subscription.ConstantRange.Contains(Time)))
+            {
+                Evaluate(Subscription, Id, *StageActor, OutNotifications);
+            }
+        }
+    }
+
+    /** Reads the subscriptions dirtied by stage edits since the last tick. */
+    bool TickDirtySubscriptions(float DeltaTime)
+    {
+        FState& State = GetState();
+        State.PendingTickHandle.Reset();
+
+        TArray<TObjectKey<AUsdStageActor>> Keys;
+        State.Stages.GetKeys(Keys);
+
+        TArray<FNotification> Notifications;
+        for (const TObjectKey<AUsdStageActor>& Key : Keys)
+        {
+            EvaluateStage(Key, true, Notifications);
+        }
+        Notify(Notifications);
+
+        return false;
+    }
+
+    /**
+     * @brief Marks subscriptions for reading on the next tick.
+     *
+     * Deferred so the stage cache has dropped its stale queries whichever order the stage actor's events are bound in.
+     */
+    void MarkDirty(const TObjectKey<AUsdStageActor>& Key, TFunctionRef<bool(const FSubscription&)> Predicate)
+    {
+        FState& State = GetState();
+        FStageEntry* Entry = State.Stages.Find(Key);
+        if (!Entry)
+        {
+            return;
+        }
+
+        bool bMarkedAny = false;
+        for (int64 Id : Entry->SubscriptionIds)
+        {
+            FSubscription& Subscription = State.Subscriptions.FindChecked(Id);
+            if (!Subscription.bDirty && Predicate(Subscription))
+            {
+                Subscription.bDirty = true;
+                bMarkedAny = true;
+            }
+        }
+
+        if (bMarkedAny && !State.PendingTickHandle.IsValid())
+        {
+            State.PendingTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickDirtySubscriptions));
+        }
+    }
+
+    /**
+     * @brief Binds to the stage actor's events so subscriptions follow time changes and stage edits.
+     *
+     * @param StageActor The stage actor the subscriptions are made on.
+     * @param Entry The stage entry to bind.
+     */
+    void BindStageActorEvents(AUsdStageActor* StageActor, FStageEntry& Entry)
+    {
+        const TObjectKey<AUsdStageActor> Key(StageActor);
+
+        FUsdStageActorEventBinding::FHandlers Handlers;
+
+        Handlers.OnStageChanged = [Key]()
+        {
+            MarkDirty(Key, [](const FSubscription&) { return true; });
+        };
+
+        Handlers.OnPrimChanged = [Key](const FString& PrimPath, bool bResync)
+        {
+            // Matches the invalidation done by the stage cache, see FUsdAttributeStageCache::HandlePrimChanged
+            const pxr::SdfPath ChangedPath = pxr::SdfPath(TCHAR_TO_UTF8(*PrimPath)).GetPrimPath();
+            MarkDirty(Key, [bResync, &ChangedPath](const FSubscription& Subscription)
+            {
+                return bResync || !Subscription.Query.IsValid() || Subscription.Query.GetAttribute().GetPrimPath().HasPrefix(ChangedPath);
+            });
+        };
+
+        Handlers.OnTimeChanged = [Key]()
+        {
+            TArray<FNotification> Notifications;
+            EvaluateStage(Key, false, Notifications);
+            Notify(Notifications);
+        };
+
+        Handlers.OnActorDestroyed = [Key]()
+        {
+            RemoveStageEntry(Key);
+        };
+
+        Entry.Events.Bind(StageActor, MoveTemp(Handlers));
+    }
+}
+
+FUsdAttributeSubscriptions& FUsdAttributeSubscriptions::Get()
+{
+    static FUsdAttributeSubscriptions Subscriptions;
+    return Subscriptions;
+}
+
+FUsdAttributeSubscriptionHandle FUsdAttributeSubscriptions::Subscribe(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, FOnUsdAttributeChanged OnChanged)
+{
+    using namespace UsdAttributeSubscriptionsImpl;
+    check(IsInGameThread());
+
+    if (!StageActor || !OnChanged.IsBound())
+    {
+        return FUsdAttributeSubscriptionHandle();
+    }
+
+    FState& State = GetState();
+    const TObjectKey<AUsdStageActor> Key(StageActor);
+    FStageEntry& Entry = State.Stages.FindOrAdd(Key);
+    if (!Entry.Events.IsBound())
+    {
+        BindStageActorEvents(StageActor, Entry);
+    }
+
+    FUsdAttributeSubscriptionHandle Handle;
+    Handle.Id = State.NextId++;
+    Entry.SubscriptionIds.Add(Handle.Id);
+
+    FSubscription& Subscription = State.Subscriptions.Add(Handle.Id);
+    Subscription.StageKey = Key;
+    Subscription.PrimName = PrimName;
+    Subscription.AttrName = AttrName;
+    Subscription.OnChanged = MoveTemp(OnChanged);
+
+    TArray<FNotification> Notifications;
+    Evaluate(Subscription, Handle.Id, *StageActor, Notifications);
+    Notify(Notifications);
+
+    return Handle;
+}
+
+void FUsdAttributeSubscriptions::Unsubscribe(FUsdAttributeSubscriptionHandle Handle)
+{
+    check(IsInGameThread());
+    UsdAttributeSubscriptionsImpl::RemoveSubscription(Handle.Id);
+}
+
+int32 FUsdAttributeSubscriptions::Num() const
+{
+    return UsdAttributeSubscriptionsImpl::GetState().Subscriptions.Num();
+}
+
+void FUsdAttributeSubscriptions::Reset()
+{
+    using namespace UsdAttributeSubscriptionsImpl;
+
+    FState& State = GetState();
+    TArray<TObjectKey<AUsdStageActor>> Keys;
+    State.Stages.GetKeys(Keys);
+    for (const TObjectKey<AUsdStageActor>& Key : Keys)
+    {
+        RemoveStageEntry(Key);
+    }
+
+    if (State.PendingTickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(State.PendingTickHandle);
+        State.PendingTickHandle.Reset();
+    }
+}
+#endif
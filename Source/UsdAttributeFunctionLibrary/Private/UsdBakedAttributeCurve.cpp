@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdBakedAttributeCurve.h"
+
+bool FUsdBakedAttributeCurve::Evaluate(double Time, double* OutComponents) const
+{
+    const int32 NumSamples = Times.Num();
+    if (NumSamples == 0)
+    {
+        return false;
+    }
+
+    const int32 Index = Cursor.FindBracket(Times, Time);
+    const double* const Neighbours[4] =
+    {
+        Index > 0 ? &Values[(Index - 1) * NumComponents] : nullptr,
+        &Values[Index * NumComponents],
+        Index + 1 < NumSamples ? &Values[(Index + 1) * NumComponents] : nullptr,
+        Index + 2 < NumSamples ? &Values[(Index + 2) * NumComponents] : nullptr
+    };
+
+    UsdAttributeInterpolation::Evaluate(Interpolation, Times, Index, Time, Neighbours, NumComponents, OutComponents);
+    return true;
+}
@@ -0,0 +1,304 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdPrimNameIndex.h"
+#include "UsdAttributeFunctionLibrary.h"
+
+#if USE_USD_SDK
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdPrimNameIndexImpl
+{
+    /** @brief Key functions allowing pxr::TfToken to be used in a TSet. */
+    struct FTokenSetKeyFuncs : DefaultKeyFuncs<pxr::TfToken>
+    {
+        static FORCEINLINE uint32 GetKeyHash(const pxr::TfToken& Key)
+        {
+            return GetTypeHash(static_cast<uint64>(Key.Hash()));
+        }
+    };
+
+    /**
+     * @brief Orders prims the way UsdStage::Traverse visits them, from the child order on the stage.
+     *
+     * The child order of each parent is cached, as a re-indexed subtree is compared against the same parents for every name.
+     */
+    class FTraversalOrder
+    {
+        using FChildOrder = TMap<pxr::TfToken, int32, FDefaultSetAllocator, TUsdTokenKeyFuncs<int32>>;
+
+    public:
+        explicit FTraversalOrder(const pxr::UsdStageRefPtr& InStage)
+            : Stage(InStage)
+        {
+        }
+
+        /** @return True if the traversal visits A before B. */
+        bool Precedes(const pxr::SdfPath& A, const pxr::SdfPath& B)
+        {
+            // Parents are visited before their descendants
+            if (A.HasPrefix(B))
+            {
+                return false;
+            }
+            if (B.HasPrefix(A))
+            {
+                return true;
+            }
+
+            // Otherwise the paths descend from different children of their common ancestor, visited in child order
+            const pxr::SdfPath Parent = A.GetCommonPrefix(B);
+            const FChildOrder& Order = GetChildOrder(Parent);
+            const int32* IndexA = Order.Find(GetChildOf(Parent, A).GetNameToken());
+            const int32* IndexB = Order.Find(GetChildOf(Parent, B).GetNameToken());
+            if (!IndexA || !IndexB)
+            {
+                return A < B;
+            }
+            return *IndexA < *IndexB;
+        }
+
+    private:
+        /** @return The ancestor of Path, or Path itself, that is a child of Parent. */
+        static pxr::SdfPath GetChildOf(const pxr::SdfPath& Parent, const pxr::SdfPath& Path)
+        {
+            pxr::SdfPath Child = Path;
+            while (Child.GetParentPath() != Parent)
+            {
+                Child = Child.GetParentPath();
+            }
+            return Child;
+        }
+
+        const FChildOrder& GetChildOrder(const pxr::SdfPath& Parent)
+        {
+            if (const FChildOrder* Found = ChildOrders.Find(Parent))
+            {
+                return *Found;
+            }
+
+            FChildOrder& Order = ChildOrders.Add(Parent);
+            if (const pxr::UsdPrim ParentPrim = Stage->GetPrimAtPath(Parent))
+            {
+                for (const pxr::TfToken& Name : ParentPrim.GetChildrenNames())
+                {
+                    Order.Add(Name, Order.Num());
+                }
+            }
+            return Order;
+        }
+
+        pxr::UsdStageRefPtr Stage;
+        TMap<pxr::SdfPath, FChildOrder, FDefaultSetAllocator, TUsdPathKeyFuncs<FChildOrder>> ChildOrders;
+    };
+}
+
+FUsdPrimNameIndex::FUsdPrimNameIndex(const UE::FUsdStage& Stage)
+{
+    Build(Stage);
+}
+
+bool FUsdPrimNameIndex::FindPrimPath(const FString& PrimName, UE::FSdfPath& OutPath) const
+{
+    const TArray<pxr::SdfPath>* Paths = FindPrimPaths(PrimName);
+    if (!Paths)
+    {
+        return false;
+    }
+
+    if (Paths->Num() > 1)
+    {
+        UE_LOG(LogUsdAttributes, Verbose, TEXT("%d prims are named %s, using %s"), Paths->Num(), *PrimName, UTF8_TO_TCHAR((*Paths)[0].GetString().c_str()));
+    }
+
+    OutPath = UE::FSdfPath((*Paths)[0]);
+    return true;
+}
+
+const TArray<pxr::SdfPath>* FUsdPrimNameIndex::FindPrimPaths(const FString& PrimName) const
+{
+    // Find doesn't register new tokens, and an unregistered token can't be the name of any prim
+    const pxr::TfToken NameToken = pxr::TfToken::Find(TCHAR_TO_UTF8(*PrimName));
+    if (NameToken.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    return PathsByName.Find(NameToken);
+}
+
+void FUsdPrimNameIndex::FindPrimPathsMatching(const UE::FUsdStage& Stage, TFunctionRef<bool(const pxr::TfToken&)> Predicate, TArray<pxr::SdfPath>& OutPaths) const
+{
+    const int32 FirstNew = OutPaths.Num();
+    int32 NumMatchedNames = 0;
+    for (const TPair<pxr::TfToken, TArray<pxr::SdfPath>>& Pair : PathsByName)
+    {
+        if (Predicate(Pair.Key))
+        {
+            OutPaths.Append(Pair.Value);
+            ++NumMatchedNames;
+        }
+    }
+
+    // Each name's paths are already in traversal order, but the names themselves aren't ordered
+    if (NumMatchedNames > 1)
+    {
+        UsdPrimNameIndexImpl::FTraversalOrder TraversalOrder(pxr::UsdStageRefPtr{ Stage });
+        Algo::Sort(MakeArrayView(OutPaths).RightChop(FirstNew), [&TraversalOrder](const pxr::SdfPath& A, const pxr::SdfPath& B)
+        {
+            return TraversalOrder.Precedes(A, B);
+        });
+    }
+}
+
+void FUsdPrimNameIndex::HandlePrimChanged(const UE::FUsdStage& Stage, const FString& PrimPath, bool bResync)
+{
+    if (!bResync)
+    {
+        return;
+    }
+
+    const pxr::SdfPath ChangedPath(TCHAR_TO_UTF8(*PrimPath));
+    if (ChangedPath.IsEmpty() || ChangedPath.IsAbsoluteRootPath())
+    {
+        Build(Stage);
+        return;
+    }
+
+    RemoveSubtree(ChangedPath.GetPrimPath());
+    IndexSubtree(Stage, ChangedPath.GetPrimPath());
+}
+
+bool FUsdPrimNameIndex::IsForStage(const UE::FUsdStage& Stage) const
+{
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+    return StageIdentity == get_pointer(UsdStage);
+}
+
+SIZE_T FUsdPrimNameIndex::GetAllocatedSize() const
+{
+    SIZE_T AllocatedSize = PathsByName.GetAllocatedSize() + PrimsByPath.GetAllocatedSize();
+    for (const TPair<pxr::TfToken, TArray<pxr::SdfPath>>& Pair : PathsByName)
+    {
+        AllocatedSize += Pair.Value.GetAllocatedSize();
+    }
+    for (const TPair<pxr::SdfPath, FIndexedPrim>& Pair : PrimsByPath)
+    {
+        AllocatedSize += Pair.Value.Children.GetAllocatedSize();
+    }
+    return AllocatedSize;
+}
+
+void FUsdPrimNameIndex::Build(const UE::FUsdStage& Stage)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+    StageIdentity = get_pointer(UsdStage);
+    PathsByName.Reset();
+    PrimsByPath.Reset();
+
+    if (UsdStage)
+    {
+        // Traverse uses the same predicate as GetChildren, so the index sees the same prims as the recursive search
+        for (const pxr::UsdPrim& Prim : UsdStage->Traverse())
+        {
+            PathsByName.FindOrAdd(Prim.GetName()).Add(Prim.GetPath());
+            AddIndexedPrim(Prim);
+        }
+    }
+
+    BuildTimeSeconds = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG(LogUsdAttributes, Log, TEXT("Indexed %d prims with %d unique names in %.2f ms using %.1f KiB"),
+        PrimsByPath.Num(), PathsByName.Num(), BuildTimeSeconds * 1000.0, GetAllocatedSize() / 1024.0);
+}
+
+void FUsdPrimNameIndex::IndexSubtree(const UE::FUsdStage& Stage, const pxr::SdfPath& RootPath)
+{
+    pxr::UsdStageRefPtr UsdStage{ Stage };
+    if (!UsdStage)
+    {
+        return;
+    }
+
+    pxr::UsdPrim RootPrim = UsdStage->GetPrimAtPath(RootPath);
+    if (!RootPrim || !pxr::UsdPrimDefaultPredicate(RootPrim))
+    {
+        return;
+    }
+
+    // The subtree's prims are visited together by the traversal, so each name's new paths form one run
+    TMap<pxr::TfToken, TArray<pxr::SdfPath>, FDefaultSetAllocator, TUsdTokenKeyFuncs<TArray<pxr::SdfPath>>> NewPathsByName;
+    for (const pxr::UsdPrim& Prim : pxr::UsdPrimRange(RootPrim))
+    {
+        NewPathsByName.FindOrAdd(Prim.GetName()).Add(Prim.GetPath());
+        AddIndexedPrim(Prim);
+    }
+
+    // Insert each run where the traversal would visit the subtree among the prims already indexed under that name
+    UsdPrimNameIndexImpl::FTraversalOrder TraversalOrder(UsdStage);
+    for (TPair<pxr::TfToken, TArray<pxr::SdfPath>>& Pair : NewPathsByName)
+    {
+        TArray<pxr::SdfPath>& Paths = PathsByName.FindOrAdd(Pair.Key);
+        const int32 InsertIndex = Algo::LowerBound(Paths, RootPath, [&TraversalOrder](const pxr::SdfPath& Path, const pxr::SdfPath& Root)
+        {
+            return TraversalOrder.Precedes(Path, Root);
+        });
+        Paths.Insert(MoveTemp(Pair.Value), InsertIndex);
+    }
+}
+
+void FUsdPrimNameIndex::RemoveSubtree(const pxr::SdfPath& RootPath)
+{
+    if (!PrimsByPath.Contains(RootPath))
+    {
+        return;
+    }
+
+    if (FIndexedPrim* Parent = PrimsByPath.Find(RootPath.GetParentPath()))
+    {
+        Parent->Children.RemoveSingleSwap(RootPath);
+    }
+
+    // Walk the subtree through the reverse index, noting which names lost paths
+    TSet<pxr::TfToken, UsdPrimNameIndexImpl::FTokenSetKeyFuncs> RemovedNames;
+    TArray<pxr::SdfPath> Pending;
+    Pending.Add(RootPath);
+    while (!Pending.IsEmpty())
+    {
+        FIndexedPrim Prim;
+        if (PrimsByPath.RemoveAndCopyValue(Pending.Pop(EAllowShrinking::No), Prim))
+        {
+            RemovedNames.Add(Prim.Name);
+            Pending.Append(MoveTemp(Prim.Children));
+        }
+    }
+
+    for (const pxr::TfToken& Name : RemovedNames)
+    {
+        TArray<pxr::SdfPath>& Paths = PathsByName.FindChecked(Name);
+        Paths.RemoveAll([this](const pxr::SdfPath& Path) { return !PrimsByPath.Contains(Path); });
+        if (Paths.IsEmpty())
+        {
+            PathsByName.Remove(Name);
+        }
+    }
+}
+
+void FUsdPrimNameIndex::AddIndexedPrim(const pxr::UsdPrim& Prim)
+{
+    const pxr::SdfPath& Path = Prim.GetPath();
+    PrimsByPath.Add(Path, FIndexedPrim{ Prim.GetName(), {} });
+    if (FIndexedPrim* Parent = PrimsByPath.Find(Path.GetParentPath()))
+    {
+        Parent->Children.Add(Path);
+    }
+}
+#endif
@@ -0,0 +1,314 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdPrimPathPattern.h"
+#include "UsdAttributeFunctionLibrary.h"
+
+#if USE_USD_SDK
+#include "Misc/ScopeRWLock.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/prim.h"
+#include "USDIncludesEnd.h"
+
+namespace UsdPrimPathPatternImpl
+{
+    const TCHAR* RegexPrefix = TEXT("re:");
+
+    /** The cache is emptied rather than grown past this, as it only fills up if patterns are generated per call. */
+    constexpr int32 MaxCachedPatterns = 1024;
+
+    /** Usd names are case sensitive, so unlike FString's default key functions these are too. */
+    template <typename ValueType>
+    struct TCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+    {
+        static FORCEINLINE bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static FORCEINLINE uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    using FPatternCache = TMap<FString, TSharedRef<const FUsdPrimPathPattern>, FDefaultSetAllocator, TCaseSensitiveKeyFuncs<TSharedRef<const FUsdPrimPathPattern>>>;
+
+    FRWLock CacheLock;
+
+    FPatternCache& GetCache()
+    {
+        static FPatternCache Cache;
+        return Cache;
+    }
+
+    /** @brief Key functions allowing pxr::SdfPath to be used in a TSet. */
+    struct FPathSetKeyFuncs : DefaultKeyFuncs<pxr::SdfPath>
+    {
+        static FORCEINLINE uint32 GetKeyHash(const pxr::SdfPath& Key)
+        {
+            return GetTypeHash(static_cast<uint64>(Key.GetHash()));
+        }
+    };
+
+    /** @brief Removes repeated paths from the end of an array, keeping the first occurrence of each. */
+    void RemoveDuplicatePaths(TArray<pxr::SdfPath>& Paths, int32 StartIndex)
+    {
+        TSet<pxr::SdfPath, FPathSetKeyFuncs> Seen;
+        Seen.Reserve(Paths.Num() - StartIndex);
+
+        int32 WriteIndex = StartIndex;
+        for (int32 ReadIndex = StartIndex; ReadIndex < Paths.Num(); ++ReadIndex)
+        {
+            bool bAlreadySeen = false;
+            Seen.Add(Paths[ReadIndex], &bAlreadySeen);
+            if (!bAlreadySeen)
+            {
+                Paths[WriteIndex++] = MoveTemp(Paths[ReadIndex]);
+            }
+        }
+        Paths.SetNum(WriteIndex, EAllowShrinking::No);
+    }
+
+    bool HasWildcards(const FString& Pattern)
+    {
+        int32 Index;
+        return Pattern.FindChar(TEXT('*'), Index) || Pattern.FindChar(TEXT('?'), Index);
+    }
+
+    /**
+     * @brief Matches a UTF-8 name against a glob where * matches any run of characters and ? any single byte.
+     *
+     * Backtracks to the last * only, so it runs in linear time for patterns with a single *.
+     */
+    bool MatchesGlob(const char* Glob, const char* Name)
+    {
+        const char* StarGlob = nullptr;
+        const char* StarName = nullptr;
+
+        while (*Name)
+        {
+            if (*Glob == '?' || (*Glob != '*' && *Glob == *Name))
+            {
+                ++Glob;
+                ++Name;
+            }
+            else if (*Glob == '*')
+            {
+                StarGlob = Glob++;
+                StarName = Name;
+            }
+            else if (StarGlob)
+            {
+                Glob = StarGlob + 1;
+                Name = ++StarName;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while (*Glob == '*')
+        {
+            ++Glob;
+        }
+        return *Glob == '\0';
+    }
+}
+
+FUsdPrimPathPattern::EKind FUsdPrimPathPattern::Classify(const FString& Pattern)
+{
+    using namespace UsdPrimPathPatternImpl;
+
+    if (Pattern.StartsWith(RegexPrefix, ESearchCase::CaseSensitive))
+    {
+        return EKind::Regex;
+    }
+
+    const bool bWildcards = HasWildcards(Pattern);
+    if (Pattern.StartsWith(TEXT("/")))
+    {
+        return bWildcards ? EKind::PathWildcard : EKind::Path;
+    }
+    return bWildcards ? EKind::NameWildcard : EKind::Name;
+}
+
+TSharedRef<const FUsdPrimPathPattern> FUsdPrimPathPattern::FindOrCompile(const FString& Pattern)
+{
+    using namespace UsdPrimPathPatternImpl;
+
+    {
+        FReadScopeLock ReadLock(CacheLock);
+        if (const TSharedRef<const FUsdPrimPathPattern>* Found = GetCache().Find(Pattern))
+        {
+            return *Found;
+        }
+    }
+
+    // Compile outside the lock, another thread may compile the same pattern meanwhile in which case theirs is kept
+    TSharedRef<const FUsdPrimPathPattern> Compiled = MakeShareable(new FUsdPrimPathPattern(Pattern));
+
+    FWriteScopeLock WriteLock(CacheLock);
+    FPatternCache& Cache = GetCache();
+    if (const TSharedRef<const FUsdPrimPathPattern>* Found = Cache.Find(Pattern))
+    {
+        return *Found;
+    }
+    if (Cache.Num() >= MaxCachedPatterns)
+    {
+        Cache.Reset();
+    }
+    return Cache.Add(Pattern, Compiled);
+}
+
+FUsdPrimPathPattern::FUsdPrimPathPattern(const FString& Pattern)
+    : Kind(Classify(Pattern))
+{
+    using namespace UsdPrimPathPatternImpl;
+
+    switch (Kind)
+    {
+    case EKind::Name:
+    case EKind::NameWildcard:
+        Glob = TCHAR_TO_UTF8(*Pattern);
+        break;
+
+    case EKind::Path:
+        Path = pxr::SdfPath(TCHAR_TO_UTF8(*Pattern));
+        break;
+
+    case EKind::PathWildcard:
+    {
+        TArray<FString> Names;
+        Pattern.ParseIntoArray(Names, TEXT("/"));
+        for (const FString& Name : Names)
+        {
+            if (Name == TEXT("**"))
+            {
+                // ** already matches any number of levels, so a run of them matches the same prims as one
+                if (Segments.IsEmpty() || !Segments.Last().bAnyDepth)
+                {
+                    Segments.AddDefaulted_GetRef().bAnyDepth = true;
+                    ++NumAnyDepthSegments;
+                }
+                continue;
+            }
+
+            FSegment& Segment = Segments.AddDefaulted_GetRef();
+            if (HasWildcards(Name))
+            {
+                Segment.Glob = TCHAR_TO_UTF8(*Name);
+            }
+            else
+            {
+                Segment.Literal = pxr::TfToken(TCHAR_TO_UTF8(*Name));
+            }
+        }
+        break;
+    }
+
+    case EKind::Regex:
+        Regex.Emplace(Pattern.RightChop(FCString::Strlen(RegexPrefix)));
+        break;
+    }
+}
+
+bool FUsdPrimPathPattern::MatchesName(const pxr::TfToken& Name) const
+{
+    return UsdPrimPathPatternImpl::MatchesGlob(Glob.c_str(), Name.GetText());
+}
+
+void FUsdPrimPathPattern::FindMatches(const pxr::UsdStageRefPtr& Stage, TArray<pxr::SdfPath>& OutPaths, bool bFirstOnly) const
+{
+    if (!Stage)
+    {
+        return;
+    }
+
+    switch (Kind)
+    {
+    case EKind::Path:
+        if (!Path.IsEmpty() && Stage->GetPrimAtPath(Path))
+        {
+            OutPaths.Add(Path);
+        }
+        break;
+
+    case EKind::PathWildcard:
+    {
+        const int32 FirstMatch = OutPaths.Num();
+        MatchSegments(Stage->GetPseudoRoot(), 0, OutPaths, bFirstOnly);
+        if (NumAnyDepthSegments > 1)
+        {
+            UsdPrimPathPatternImpl::RemoveDuplicatePaths(OutPaths, FirstMatch);
+        }
+        break;
+    }
+
+    case EKind::Regex:
+        for (const pxr::UsdPrim& Prim : Stage->Traverse())
+        {
+            FRegexMatcher Matcher(*Regex, UTF8_TO_TCHAR(Prim.GetPath().GetText()));
+            if (Matcher.FindNext())
+            {
+                OutPaths.Add(Prim.GetPath());
+                if (bFirstOnly)
+                {
+                    break;
+                }
+            }
+        }
+        break;
+
+    default:
+        UE_LOG(LogUsdAttributes, Warning, TEXT("Prim names are matched through the name index rather than by traversing the stage"));
+        break;
+    }
+}
+
+bool FUsdPrimPathPattern::MatchSegments(const pxr::UsdPrim& Prim, int32 SegmentIndex, TArray<pxr::SdfPath>& OutPaths, bool bFirstOnly) const
+{
+    if (SegmentIndex == Segments.Num())
+    {
+        // The pseudo root is only reached by a pattern made of ** segments, and isn't a prim that can be addressed
+        if (Prim.IsPseudoRoot())
+        {
+            return false;
+        }
+        OutPaths.Add(Prim.GetPath());
+        return bFirstOnly;
+    }
+
+    const FSegment& Segment = Segments[SegmentIndex];
+    if (!Segment.Literal.IsEmpty())
+    {
+        // GetChild doesn't apply the default predicate that Traverse and GetChildren use, so check it here
+        const pxr::UsdPrim Child = Prim.GetChild(Segment.Literal);
+        return Child && pxr::UsdPrimDefaultPredicate(Child) && MatchSegments(Child, SegmentIndex + 1, OutPaths, bFirstOnly);
+    }
+
+    if (Segment.bAnyDepth && MatchSegments(Prim, SegmentIndex + 1, OutPaths, bFirstOnly))
+    {
+        return true;
+    }
+
+    for (const pxr::UsdPrim& Child : Prim.GetChildren())
+    {
+        if (Segment.bAnyDepth)
+        {
+            // Stays on this segment, so the ** goes on matching deeper levels
+            if (MatchSegments(Child, SegmentIndex, OutPaths, bFirstOnly))
+            {
+                return true;
+            }
+        }
+        else if (UsdPrimPathPatternImpl::MatchesGlob(Segment.Glob.c_str(), Child.GetName().GetText())
+            && MatchSegments(Child, SegmentIndex + 1, OutPaths, bFirstOnly))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
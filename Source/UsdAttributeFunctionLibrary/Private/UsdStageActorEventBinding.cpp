@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UsdStageActorEventBinding.h"
+#include "USDStageActor.h"
+
+void FUsdStageActorEventBinding::Bind(AUsdStageActor* InStageActor, FHandlers Handlers)
+{
+    Unbind();
+
+    if (!InStageActor)
+    {
+        return;
+    }
+
+    StageActor = InStageActor;
+
+    // A handler may unbind, which destroys the delegate running it, so each call holds its own reference to the handlers
+    const TSharedRef<const FHandlers> SharedHandlers = MakeShared<const FHandlers>(MoveTemp(Handlers));
+
+    if (SharedHandlers->OnStageChanged)
+    {
+        StageChangedHandle = InStageActor->OnStageChanged.AddLambda([SharedHandlers]()
+        {
+            const TSharedRef<const FHandlers> Pinned = SharedHandlers;
+            Pinned->OnStageChanged();
+        });
+    }
+
+    if (SharedHandlers->OnPrimChanged)
+    {
+        PrimChangedHandle = InStageActor->OnPrimChanged.AddLambda([SharedHandlers](const FString& PrimPath, bool bResync)
+        {
+            const TSharedRef<const FHandlers> Pinned = SharedHandlers;
+            Pinned->OnPrimChanged(PrimPath, bResync);
+        });
+    }
+
+    if (SharedHandlers->OnTimeChanged)
+    {
+        TimeChangedHandle = InStageActor->OnTimeChanged.AddLambda([SharedHandlers]()
+        {
+            const TSharedRef<const FHandlers> Pinned = SharedHandlers;
+            Pinned->OnTimeChanged();
+        });
+    }
+
+    if (SharedHandlers->OnActorDestroyed)
+    {
+        ActorDestroyedHandle = InStageActor->OnActorDestroyed.AddLambda([SharedHandlers]()
+        {
+            const TSharedRef<const FHandlers> Pinned = SharedHandlers;
+            Pinned->OnActorDestroyed();
+        });
+    }
+}
+
+void FUsdStageActorEventBinding::Unbind()
+{
+    if (AUsdStageActor* Actor = StageActor.Get())
+    {
+        Actor->OnStageChanged.Remove(StageChangedHandle);
+        Actor->OnPrimChanged.Remove(PrimChangedHandle);
+        Actor->OnTimeChanged.Remove(TimeChangedHandle);
+        Actor->OnActorDestroyed.Remove(ActorDestroyedHandle);
+    }
+
+    StageActor.Reset();
+    StageChangedHandle.Reset();
+    PrimChangedHandle.Reset();
+    TimeChangedHandle.Reset();
+    ActorDestroyedHandle.Reset();
+}
@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeTypes.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/vt/array.h"
+#include "UsdWrappers/UsdStage.h"
+#include "USDIncludesEnd.h"
+
+/**
+ * @brief Helpers for reading array valued attributes such as points, normals and primvars in bulk.
+ *
+ * VtArrays are reference counted and copy on write, so a VtArray read from an attribute shares the
+ * buffer held by Usd. MakeArrayView exposes that buffer without copying for as long as the VtArray
+ * is kept alive. The Convert functions write a whole array into Unreal types in one pass, remapping
+ * Vec3 values to Unreal's axes and units with a vectorised kernel split across worker threads.
+ */
+namespace UsdAttributeArrays
+{
+    /**
+     * @brief The axis and unit remap from a stage to Unreal for one kind of vector.
+     *
+     * Matches the conversion used by the USD importer: Z up stages flip Y to change handedness, Y up
+     * stages swap Y and Z, and positions are scaled from metersPerUnit to centimeters.
+     */
+    struct USDATTRIBUTELIBRARY_API FUsdAxisConversion
+    {
+        /** Whether Y and Z are swapped, for Y up stages. */
+        bool bSwapYZ = false;
+
+        /** The per component scale applied after any swap. */
+        FVector Scale = FVector::OneVector;
+
+        /**
+         * @brief Reads the upAxis and metersPerUnit of a stage.
+         *
+         * @param Stage The stage the values were read from.
+         * @param Conversion The kind of vector being converted.
+         * @return The remap to apply, which is the identity for EUsdVectorConversion::None.
+         */
+        static FUsdAxisConversion FromStage(const UE::FUsdStage& Stage, EUsdVectorConversion Conversion);
+    };
+
+    /** @return A view of the array's buffer, valid while Array is kept alive and unmodified. */
+    template <typename ElementType>
+    TArrayView<const ElementType> MakeArrayView(const pxr::VtArray<ElementType>& Array)
+    {
+        return TArrayView<const ElementType>(Array.cdata(), static_cast<int32>(Array.size()));
+    }
+
+    /**
+     * @brief Converts an array of Vec3f values, e.g. points or normals, in one pass.
+     *
+     * @param Values The Usd values.
+     * @param Conversion The axis and unit remap to apply.
+     * @param OutValues Receives one FVector per value.
+     */
+    USDATTRIBUTELIBRARY_API void ConvertVectors(TArrayView<const pxr::GfVec3f> Values, const FUsdAxisConversion& Conversion, TArray<FVector>& OutValues);
+
+    /** Overload for Vec3d values, see above. */
+    USDATTRIBUTELIBRARY_API void ConvertVectors(TArrayView<const pxr::GfVec3d> Values, const FUsdAxisConversion& Conversion, TArray<FVector>& OutValues);
+
+    /** Converts an array of Vec2f values, e.g. texture coordinates, in one pass. */
+    USDATTRIBUTELIBRARY_API void ConvertVectors(TArrayView<const pxr::GfVec2f> Values, TArray<FVector2D>& OutValues);
+}
+#endif
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "UsdAttributeTypes.h"
+#include "UsdAttributeAsyncAction.generated.h"
+
+class AUsdStageActor;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUsdAttributeAsyncResultPin, const FUsdAttributeResult&, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUsdAttributeBatchAsyncResultPin, const TArray<FUsdAttributeResult>&, Results);
+
+/**
+ * @brief Latent Blueprint node reading a single Usd attribute on a worker task.
+ *
+ * Use instead of the GetUsd...Attribute nodes where the read could hitch the game thread, e.g. the
+ * first read on a large stage, which builds the stage's prim name index. The output pins fire on the
+ * game thread once the value has been read.
+ *
+ * The read runs alongside the game thread, and Usd stages aren't safe to edit while another thread reads
+ * them. Don't start the node while the stage can be edited before it completes, e.g. during sequencer
+ * playback that writes to the stage, undo or redo, or layer edits from Python or the editor. The cache
+ * only learns of an edit once it has been made, so it can't hold the edit back for the read.
+ */
+UCLASS()
+class USDATTRIBUTELIBRARY_API UUsdAttributeAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Reads a Usd attribute without blocking the game thread.
+     *
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute to retrieve.
+     * @param Type The type the attribute value should be read as.
+     * @param bAnimated Whether to read the value at TimeSample, otherwise the default value is read.
+     * @param TimeSample The time sample to read the value at.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes", meta = (BlueprintInternalUseOnly = "true"))
+    static UUsdAttributeAsyncAction* GetUsdAttributeAsync(AUsdStageActor* StageActor, FString PrimName, FString AttrName,
+        EUsdAttributeValueType Type, bool bAnimated, double TimeSample);
+
+    /** Fires when the value has been read. */
+    UPROPERTY(BlueprintAssignable)
+    FUsdAttributeAsyncResultPin OnSuccess;
+
+    /** Fires when the value couldn't be read, the result's status says why. */
+    UPROPERTY(BlueprintAssignable)
+    FUsdAttributeAsyncResultPin OnFailure;
+
+    virtual void Activate() override;
+
+private:
+    TWeakObjectPtr<AUsdStageActor> StageActor;
+    FUsdAttributeRequest Request;
+};
+
+/**
+ * @brief Latent Blueprint node reading several Usd attributes on a worker task.
+ *
+ * The asynchronous counterpart of GetUsdAttributesBatch, completing on the game thread. Like
+ * UUsdAttributeAsyncAction, it must not be started while the stage can be edited before it completes.
+ */
+UCLASS()
+class USDATTRIBUTELIBRARY_API UUsdAttributeBatchAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Reads several Usd attributes without blocking the game thread.
+     *
+     * @param StageActor The current UsdStageActor.
+     * @param Requests The prim, attribute, type and time of each value to read.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes", meta = (BlueprintInternalUseOnly = "true"))
+    static UUsdAttributeBatchAsyncAction* GetUsdAttributesBatchAsync(AUsdStageActor* StageActor, const TArray<FUsdAttributeRequest>& Requests);
+
+    /** Fires once every request has been read, failures are reported through each result's status. */
+    UPROPERTY(BlueprintAssignable)
+    FUsdAttributeBatchAsyncResultPin OnCompleted;
+
+    virtual void Activate() override;
+
+private:
+    TWeakObjectPtr<AUsdStageActor> StageActor;
+    TArray<FUsdAttributeRequest> Requests;
+};
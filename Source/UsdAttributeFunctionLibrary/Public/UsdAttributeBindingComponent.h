@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UsdAttributeTypes.h"
+#include "UsdAttributeBindingComponent.generated.h"
+
+class AUsdStageActor;
+
+/**
+ * @brief Drives properties and material parameters of its actor from Usd attributes.
+ *
+ * Replaces Blueprint graphs calling GetUsdAnimated...Attribute on tick. The component doesn't tick
+ * itself: every binding component in a world is evaluated by the UUsdAttributeBindingSubsystem in
+ * one pass per frame, at each stage actor's current time. Bindings are grouped by stage and prim so
+ * each prim is found once, and their property paths are resolved once rather than on every frame.
+ */
+UCLASS(ClassGroup = (Usd), meta = (BlueprintSpawnableComponent))
+class USDATTRIBUTELIBRARY_API UUsdAttributeBindingComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UUsdAttributeBindingComponent();
+
+    /** The stage actor to read the attributes from. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    TObjectPtr<AUsdStageActor> StageActor;
+
+    /** The attributes to read and where to write them. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    TArray<FUsdAttributeBinding> Bindings;
+
+    /**
+     * @brief Replaces the stage actor the attributes are read from.
+     *
+     * @param InStageActor The stage actor.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    void SetStageActor(AUsdStageActor* InStageActor);
+
+    /**
+     * @brief Replaces the bindings.
+     *
+     * @param InBindings The attributes to read and where to write them.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    void SetBindings(const TArray<FUsdAttributeBinding>& InBindings);
+
+    /**
+     * @brief Resolves the bindings again, e.g. after components named by a property path were added or replaced.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    void RefreshBindings();
+
+    virtual void OnRegister() override;
+    virtual void OnUnregister() override;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
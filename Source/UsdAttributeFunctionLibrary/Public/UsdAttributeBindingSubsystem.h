@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UsdAttributeTypes.h"
+#include "UsdAttributeBindingSubsystem.generated.h"
+
+class AUsdStageActor;
+class UMaterialInstanceDynamic;
+class UUsdAttributeBindingComponent;
+
+/**
+ * @brief Where one binding's value is written, resolved once from its property path or material slot.
+ */
+struct FUsdAttributeBindingTarget
+{
+    EUsdAttributeBindingTarget Kind = EUsdAttributeBindingTarget::Property;
+
+    /** The last object along the property path, or the material's component. */
+    TWeakObjectPtr<UObject> Object;
+
+    /** The properties from Object to the written property, descending through structs. */
+    TArray<const FProperty*> PropertyChain;
+
+    /** Whether the property is one of a scene component's relative transform properties. */
+    bool bIsRelativeTransform = false;
+
+    TWeakObjectPtr<UMaterialInstanceDynamic> Material;
+    FName ParameterName;
+
+    /** The value last written to the material parameter, scalars in R, so unchanged values aren't pushed to the render thread again. */
+    TOptional<FLinearColor> LastParameterValue;
+};
+
+/**
+ * @brief The bindings reading from a single prim, read together with one batch call.
+ */
+struct FUsdAttributeBindingGroup
+{
+    TWeakObjectPtr<AUsdStageActor> StageActor;
+    TArray<FUsdAttributeRequest> Requests;
+    TArray<FUsdAttributeResult> Results;
+    TArray<FUsdAttributeBindingTarget> Targets;
+
+    /** The requests left to the batch read this frame, after the baked curves and samplers have been read on the game thread. */
+    TBitArray<> BatchedRequests;
+};
+
+/**
+ * @brief Evaluates every UsdAttributeBindingComponent in a world once per frame.
+ *
+ * Bindings are compiled into one group per stage and prim when components are registered or changed.
+ * Each frame the bindings with a baked curve or an interpolation set are read from them on the game
+ * thread, like the GetUsdAnimated...Attribute functions do. The rest of the groups are read through
+ * the stage caches at each stage actor's current time, in parallel when there are enough of them and
+ * UsdAttributes.Bindings.Parallel is set, and the values are then written to their properties and
+ * material parameters on the game thread. Material parameters are only set when their value changed.
+ *
+ * Only created for game and PIE worlds. Bindings write properties and create dynamic material instances
+ * directly, which in an editor world would dirty the level and be saved with it.
+ */
+UCLASS()
+class USDATTRIBUTELIBRARY_API UUsdAttributeBindingSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Adds a component's bindings to the evaluation.
+     *
+     * @param Component The registered component.
+     */
+    void RegisterComponent(UUsdAttributeBindingComponent* Component);
+
+    /**
+     * @brief Removes a component's bindings from the evaluation.
+     *
+     * @param Component The unregistered component.
+     */
+    void UnregisterComponent(UUsdAttributeBindingComponent* Component);
+
+    /** Compiles the bindings again before the next evaluation. */
+    void MarkBindingsDirty() { bBindingsDirty = true; }
+
+    /** Reads and applies every binding straight away, rather than waiting for the next tick. */
+    void EvaluateBindings();
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickableInEditor() const override { return false; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Resolves every registered component's bindings into Groups. */
+    void CompileBindings();
+
+    TArray<TWeakObjectPtr<UUsdAttributeBindingComponent>> Components;
+    TArray<FUsdAttributeBindingGroup> Groups;
+    bool bBindingsDirty = false;
+};
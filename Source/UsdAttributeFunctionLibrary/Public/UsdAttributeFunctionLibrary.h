@@ -14,6 +14,20 @@
 
 #include "Modules/ModuleManager.h"
 
+/**
+ * Attribute reads happen every tick, so anything below Warning is compiled out of shipping and test
+ * builds. Define USDATTRIBUTES_COMPILE_VERBOSITY to override this, e.g. to Log for profiling builds.
+ */
+#ifndef USDATTRIBUTES_COMPILE_VERBOSITY
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+#define USDATTRIBUTES_COMPILE_VERBOSITY Warning
+#else
+#define USDATTRIBUTES_COMPILE_VERBOSITY All
+#endif
+#endif
+
+USDATTRIBUTELIBRARY_API DECLARE_LOG_CATEGORY_EXTERN(LogUsdAttributes, Log, USDATTRIBUTES_COMPILE_VERBOSITY);
+
 class FUsdAttributeFunctionLibraryModule : public IModuleInterface
 {
 public:
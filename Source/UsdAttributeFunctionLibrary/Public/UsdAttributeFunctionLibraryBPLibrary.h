@@ -12,10 +12,19 @@
 #include "pxr/base/gf/vec3i.h"
 #include "UsdWrappers/VtValue.h"
 #include "UsdWrappers/UsdAttribute.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/usd/attributeQuery.h"
 #include "USDIncludesEnd.h"
+#include "UsdAttributeTypeRegistry.h"
 #endif
 
+#include <type_traits>
+
+#include "Async/Future.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "UsdAttributeFunctionLibrary.h"
+#include "UsdAttributeStats.h"
+#include "UsdAttributeTypes.h"
 #include "UsdAttributeFunctionLibraryBPLibrary.generated.h"
 
 /**
@@ -24,7 +33,12 @@
  * This class provides static functions that can be called from Blueprints to access
  * attributes from a UsdStageActor directly from the Usd file.
  * These functions call internal template functions to return the Usd value of that type
- * as well as values at given timesamples.
+ * as well as values at given timesamples. Conversions from Usd value types are defined in
+ * UsdAttributeTypeRegistry.h, so every getter shares the same lookup and conversion path.
+ *
+ * Prims can be addressed by name, by absolute path, or with wildcard and regular expression patterns,
+ * see FUsdPrimPathPattern. Paths are looked up directly, so they skip the name search and can't pick
+ * the wrong prim when names repeat under different parents.
  *
  * Throughout the class, #if USE_USD_SDK is used frequently, which is required to access
  * USD functionality at runtime as of 5.4.2. Usd functionality will be updated with the
@@ -42,8 +56,13 @@ namespace UE
 	class FSdfPath;
 	class FUsdAttribute;
 }
+
+class FUsdAttributeStageCache;
 #endif
 
+/** Called by SubscribeToUsdAttribute with the attribute's new value. */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FUsdAttributeChangedDynamic, const FUsdAttributeResult&, Result);
+
 UCLASS()
 class USDATTRIBUTELIBRARY_API UUsdAttributeFunctionLibraryBPLibrary : public UBlueprintFunctionLibrary
 {
@@ -61,11 +80,108 @@ public:
      */
     static UE::FUsdAttribute GetUsdAttributeInternal(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
 
+    /**
+     * @brief Resolves the value of a Usd attribute through the stage's cached attribute queries.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute to retrieve.
+     * @param TimeSample The time sample to read, or unset for the default value.
+     * @param OutValue The resolved attribute value.
+     * @return True if the attribute was found and a value was resolved.
+     */
+    static bool GetCachedUsdAttributeValue(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, UE::FVtValue& OutValue);
+
+    /**
+     * @brief Resolves the value of a Usd attribute through a stage cache that has already been found. Safe to call from worker tasks.
+     * 
+     * @param StageCache The cache for the stage to read from.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute to retrieve.
+     * @param TimeSample The time sample to read, or unset for the default value.
+     * @param OutValue The resolved attribute value.
+     * @return True if the attribute was found and a value was resolved.
+     */
+    static bool GetCachedUsdAttributeValue(FUsdAttributeStageCache& StageCache, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, UE::FVtValue& OutValue);
+
+    /**
+     * @brief Reads several Usd attributes through a stage cache that has already been found. Safe to call from worker tasks.
+     * 
+     * @param StageCache The cache for the stage to read from.
+     * @param Requests The prim, attribute, type and time of each value to read.
+     * @param Results The value and status of each request, which must already be sized to match Requests.
+     * @param RequestsToRead If set, only the requests whose bit is set are read and the other results are left untouched.
+     */
+    static void ReadUsdAttributesBatch(FUsdAttributeStageCache& StageCache, const TArray<FUsdAttributeRequest>& Requests, TArray<FUsdAttributeResult>& Results,
+        const TBitArray<>* RequestsToRead = nullptr);
+
+    /**
+     * @brief Reads a time sampled attribute, resolving the stage cache and attribute query once for every source.
+     * 
+     * Reads from the baked curve when the stage has opted in, then from the attribute's sampler when its
+     * interpolation has been set, which both fill OutComponents. Otherwise the value is resolved through Usd.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @param TimeSample The time to read at.
+     * @param OutComponents Receives NumComponents values when read from a baked curve or sampler.
+     * @param NumComponents The number of values the caller's type is made of, or 0 if it can't be baked or sampled.
+     * @param bOutReadComponents Set to true if OutComponents was filled rather than OutValue.
+     * @param OutValue The value resolved through Usd.
+     * @return True if a value was read.
+     */
+    static bool GetAnimatedUsdAttributeValue(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, double TimeSample,
+        double* OutComponents, int32 NumComponents, bool& bOutReadComponents, UE::FVtValue& OutValue);
+
+    /**
+     * @brief Evaluates the baked curve of an attribute, if baked curves are enabled for the stage.
+     * 
+     * @param StageCache The cache for the stage to read from.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @param TimeSample The time to evaluate the curve at.
+     * @param OutComponents Receives NumComponents values.
+     * @param NumComponents The number of values expected per sample.
+     * @return True if a baked curve with the expected layout was evaluated.
+     */
+    static bool EvaluateBakedUsdAttribute(FUsdAttributeStageCache& StageCache, const FString& PrimName, const FString& AttrName, double TimeSample, double* OutComponents, int32 NumComponents);
+
+    /**
+     * @brief Samples an attribute whose interpolation was set with SetUsdAttributeInterpolation.
+     * 
+     * @param StageCache The cache for the stage to read from.
+     * @param Query The attribute's query, already resolved by the caller.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @param TimeSample The time to sample at.
+     * @param OutComponents Receives NumComponents values.
+     * @param NumComponents The number of values expected per sample.
+     * @return True if a sampler with the expected layout was evaluated.
+     */
+    static bool EvaluateSampledUsdAttribute(FUsdAttributeStageCache& StageCache, const pxr::UsdAttributeQuery& Query, const FString& PrimName, const FString& AttrName, double TimeSample, double* OutComponents, int32 NumComponents);
+
+    /**
+     * @brief Reads an array valued attribute without copying its elements.
+     * 
+     * The returned VtArray shares the buffer resolved by Usd, and UsdAttributeArrays::MakeArrayView
+     * can view it as a TArrayView. Supported for float, int, GfVec2f, GfVec3f and GfVec3d elements.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the array attribute, e.g. points or primvars:st.
+     * @param TimeSample The time sample to read, or unset for the default value.
+     * @param OutArray The resolved array.
+     * @return True if the attribute was found and holds an array of ElementType.
+     */
+    template <typename ElementType>
+    static bool GetUsdArrayAttribute(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, TOptional<double> TimeSample, pxr::VtArray<ElementType>& OutArray);
+
     /**
      * @brief Extract the value of a useable type from the VtValue type.
      * 
      * @param Value The Usd value containing the attribute data.
-     * @return The extracted value of type T.
+     * @return The extracted value of type T, or a default T if the value can't be converted.
      */
     template <typename T>
     static T ExtractAttributeValue(UE::FVtValue& Value);
@@ -101,8 +217,54 @@ public:
      */
     template <typename T>
     static T GetUsdAnimatedAttributeValueInternal(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    /**
+     * @brief Samples a Usd attribute over a time range, resolving the attribute once for all samples.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute to retrieve.
+     * @param StartTime The first time of the range.
+     * @param EndTime The last time of the range, inclusive.
+     * @param Step The interval between samples, ignored when using the authored time samples.
+     * @param bUseAuthoredTimeSamples Whether to sample at the attribute's authored time samples within the range instead of at every Step.
+     * @param OutTimes The times that were sampled.
+     * @param OutValues The attribute value at each of OutTimes.
+     * @return True if the attribute was found and every sample holds a value of type T.
+     */
+    template <typename T>
+    static bool GetUsdAnimatedAttributeRangeInternal(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName,
+        double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes, TArray<T>& OutValues);
 #endif
 
+    /**
+     * @brief Reads several Usd attributes on a worker task. Must be called from the game thread.
+     * 
+     * Prim lookup (including building the name index on first use), attribute resolution and value
+     * extraction run on the task graph, and the future is fulfilled from the game thread. The stage must
+     * not be edited until the future is fulfilled, as the worker reads it directly.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param Requests The prim, attribute, type and time of each value to read.
+     * @return A future for the value and status of each request, in the same order as Requests.
+     */
+    static TFuture<TArray<FUsdAttributeResult>> GetUsdAttributesBatchAsync(AUsdStageActor* StageActor, TArray<FUsdAttributeRequest> Requests);
+
+    /**
+     * @brief Reads the value of a single Usd attribute on a worker task. Must be called from the game thread.
+     * 
+     * Supported for float, double, int and FVector. Baked curves are not used. The stage must not be
+     * edited until the future is fulfilled, as the worker reads it directly.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute to retrieve.
+     * @param TimeSample The time sample to read, or unset for the default value.
+     * @return A future for the value, which is unset if the attribute wasn't found or doesn't hold a T.
+     */
+    template <typename T>
+    static TFuture<TOptional<T>> GetUsdAttributeValueAsync(AUsdStageActor* StageActor, FString PrimName, FString AttrName, TOptional<double> TimeSample = TOptional<double>());
+
     /**
      * Blueprint Callable functions to access the templates using their given types
      */
@@ -130,6 +292,220 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
     static int GetUsdAnimatedIntAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
 
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static bool GetUsdBoolAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FVector2D GetUsdVec2Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FVector4 GetUsdVec4Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FQuat GetUsdQuatAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FMatrix GetUsdMatrixAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    /** Reads string, token and asset attributes, asset paths are returned resolved where possible. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FString GetUsdStringAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    /** Reads color3 and color4 attributes, color3 values have an alpha of 1. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FLinearColor GetUsdColorAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static bool GetUsdAnimatedBoolAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FVector2D GetUsdAnimatedVec2Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FVector4 GetUsdAnimatedVec4Attribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FQuat GetUsdAnimatedQuatAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FMatrix GetUsdAnimatedMatrixAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FString GetUsdAnimatedStringAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UsdAttributes")
+    static FLinearColor GetUsdAnimatedColorAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    /**
+     * Blueprint Callable functions returning array valued attributes such as points, normals and primvars,
+     * converted in bulk. Vec3 arrays can be remapped to Unreal's axes and units as they are converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<float> GetUsdFloatArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<int> GetUsdIntArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FVector2D> GetUsdVec2ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FVector> GetUsdVec3ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, EUsdVectorConversion Conversion);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<float> GetUsdAnimatedFloatArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<int> GetUsdAnimatedIntArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FVector2D> GetUsdAnimatedVec2ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FVector> GetUsdAnimatedVec3ArrayAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample, EUsdVectorConversion Conversion);
+
+    /**
+     * Blueprint Callable functions returning every value of an animated attribute within [StartTime, EndTime],
+     * either every Step or at the authored time samples, along with the times they were sampled at
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FVector> GetUsdAnimatedVec3AttributeRange(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<float> GetUsdAnimatedFloatAttributeRange(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<double> GetUsdAnimatedDoubleAttributeRange(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes);
+
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<int> GetUsdAnimatedIntAttributeRange(AUsdStageActor* StageActor, FString PrimName, FString AttrName, double StartTime, double EndTime, double Step, bool bUseAuthoredTimeSamples, TArray<double>& OutTimes);
+
+    /**
+     * @brief Bakes time sampled attributes into dense curves for fast playback, e.g. from BeginPlay.
+     * 
+     * Baking alone doesn't change what the getters return, call SetUseBakedUsdAttributeCurves to opt in.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param Requests The attributes to bake and how to interpolate them.
+     * @return The number of attributes that were baked.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static int32 BakeUsdAttributeCurves(AUsdStageActor* StageActor, const TArray<FUsdAttributeCurveRequest>& Requests);
+
+    /**
+     * @brief Sets whether the GetUsdAnimated nodes read baked attributes from their curves instead of resolving them through Usd.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param bUseBakedCurves Whether to read from the baked curves.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static void SetUseBakedUsdAttributeCurves(AUsdStageActor* StageActor, bool bUseBakedCurves);
+
+    /**
+     * @brief Drops every curve baked for the stage.
+     * 
+     * @param StageActor The current UsdStageActor.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static void ClearBakedUsdAttributeCurves(AUsdStageActor* StageActor);
+
+    /**
+     * @brief Sets how the GetUsdAnimated nodes interpolate a float, double, int or Vec3 attribute between its time samples.
+     * 
+     * By default values are interpolated by Usd, with the stage's interpolation type, on every read. Once
+     * set, the attribute is read through a sampler that remembers where the previous read was, so reads
+     * at increasing times during playback only read the samples they move into. Baked curves still take
+     * precedence when enabled.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the time sampled attribute.
+     * @param Interpolation How values are reconstructed between samples. Int attributes are always held.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static void SetUsdAttributeInterpolation(AUsdStageActor* StageActor, FString PrimName, FString AttrName, EUsdAttributeInterpolation Interpolation);
+
+    /**
+     * @brief Reads an attribute through Usd again after SetUsdAttributeInterpolation.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static void ResetUsdAttributeInterpolation(AUsdStageActor* StageActor, FString PrimName, FString AttrName);
+
+    /**
+     * @brief Reads several Usd attributes in a single call.
+     * 
+     * The stage is resolved once and the requests are grouped by prim, so each prim is found once
+     * however many of its attributes are requested. Failures are reported through each result's
+     * status rather than logged per entry.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param Requests The prim, attribute, type and time of each value to read.
+     * @param Results The value and status of each request, in the same order as Requests.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static void GetUsdAttributesBatch(AUsdStageActor* StageActor, const TArray<FUsdAttributeRequest>& Requests, TArray<FUsdAttributeResult>& Results);
+
+    /**
+     * @brief Calls an event whenever the value of a Usd attribute changes, instead of reading it every tick.
+     * 
+     * The event is called straight away with the current value, then whenever an edit to the stage or a
+     * change of the stage actor's time changes the value. Time changes that stay between the same held
+     * time samples don't call the event. If the attribute is removed, the event is called with a
+     * NoValue status. The subscription ends when the event's object is destroyed.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute to subscribe to.
+     * @param Type The type the attribute value should be read as.
+     * @param OnChanged Called with the attribute's value whenever it changes.
+     * @return The handle to pass to UnsubscribeFromUsdAttribute.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static FUsdAttributeSubscriptionHandle SubscribeToUsdAttribute(AUsdStageActor* StageActor, FString PrimName, FString AttrName,
+        EUsdAttributeValueType Type, FUsdAttributeChangedDynamic OnChanged);
+
+    /**
+     * @brief Ends a subscription made with SubscribeToUsdAttribute.
+     * 
+     * @param Handle The subscription's handle, which is reset.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static void UnsubscribeFromUsdAttribute(UPARAM(ref) FUsdAttributeSubscriptionHandle& Handle);
+
+    /**
+     * @brief Finds every prim matching a name, path or pattern.
+     * 
+     * Accepts the same addresses as the PrimName of the getters: a bare name, an absolute path such as
+     * /CTRL_MASTER/shot010/camera1, a name or path with * and ? wildcards, where a ** path segment
+     * matches any number of levels, or a regular expression prefixed with re:. The getters read from the
+     * first of these prims.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name, path or pattern of the Usd prims.
+     * @return The paths of the matching prims.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FString> FindUsdPrimPaths(AUsdStageActor* StageActor, FString PrimName);
+
+    /**
+     * @brief Finds every prim that authors an attribute with a given name, such as cameraNumber.
+     * 
+     * Answered from an index of attribute names built once per stage, rather than by visiting every
+     * prim. Only attributes with authored values are found, not schema attributes left at their defaults.
+     * 
+     * @param StageActor The current UsdStageActor.
+     * @param AttrName The attribute name, or a pattern with * and ? wildcards such as customColour_*.
+     * @param bCustomOnly Whether to only find custom attributes, rather than those defined by the prim's schema.
+     * @param OutAttrNames The name of the matching attribute for each returned prim path, as a wildcard may match several per prim.
+     * @return The paths of the prims authoring a matching attribute, once per matching attribute.
+     */
+    UFUNCTION(BlueprintCallable, Category = "UsdAttributes")
+    static TArray<FString> FindUsdPrimsWithAttribute(AUsdStageActor* StageActor, FString AttrName, bool bCustomOnly, TArray<FString>& OutAttrNames);
+
     /**
      * @brief Converts a standard XYZ vector to the equivalent FRotator
      * 
@@ -142,6 +518,8 @@ public:
 #if USE_USD_SDK
     /**
      * @brief Retrieves the SDF path of a prim with a specified name.
+     *
+     * Performs a full depth first search, prefer FUsdPrimNameIndex for repeated lookups.
      * 
      * @param CurrentPrim The current Usd prim being examined.
      * @param TargetName The name of the target prim.
@@ -158,18 +536,15 @@ T UUsdAttributeFunctionLibraryBPLibrary::ExtractAttributeValue(UE::FVtValue& Val
     // Access the pxr VtValue from the Unreal wrapped FVtValue
     pxr::VtValue& PxrValue = Value.GetUsdValue();
     
-	// Check to ensure the value is of the specified type
-    if (PxrValue.IsHolding<T>())
+	// Convert through the type registry, which checks the held type with a single switch
+    T AttrValue = T();
+    if (UsdAttributeTypeRegistry::ConvertUsdValue(PxrValue, AttrValue))
     {
-        // Access the value of the specified type from the VtValue
-        T AttrValue = PxrValue.Get<T>();
-        UE_LOG(LogTemp, Log, TEXT("Successfully retrieved attribute"));
+        UE_LOG(LogUsdAttributes, VeryVerbose, TEXT("Successfully retrieved attribute"));
         return AttrValue;
     }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Attribute is not holding a value of specified type"));
-    }
+
+    UE_LOG(LogUsdAttributes, Warning, TEXT("Attribute is not holding a value of specified type"));
     return T();
 }
 
@@ -177,22 +552,10 @@ template <typename T>
 T UUsdAttributeFunctionLibraryBPLibrary::GetUsdAttributeValueInternal(
     AUsdStageActor* StageActor, FString PrimName, FString AttrName)
 {
-    UE::FUsdAttribute Attr = GetUsdAttributeInternal(StageActor, PrimName, AttrName);
-
-	// Check that an attribute has been found from the given inputs
-    if (!Attr)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Specified attribute is not holding any value"))
-        return T();
-    }
-
-	// Using the Unreal wrapper of the pxr type VtValue
+	// Using the Unreal wrapper of the pxr type VtValue, resolved through the cached attribute query
     UE::FVtValue Value;
-    bool bSuccess = Attr.Get(Value);
-
-    if (!bSuccess)
+    if (!GetCachedUsdAttributeValue(StageActor, PrimName, AttrName, TOptional<double>(), Value))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Failed to get value for Attribute: %s"), *Attr.GetName().ToString());
         return T();
     }
 
@@ -204,23 +567,32 @@ template <typename T>
 T UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal(
     AUsdStageActor* StageActor, FString PrimName, FString AttrName, double TimeSample)
 {
-    UE::FUsdAttribute Attr = GetUsdAttributeInternal(StageActor, PrimName, AttrName);
-    
-    // Check that an attribute has been found from the given inputs
-    if (!Attr)
+    // Only scalar and Vec3 attributes can be baked or sampled, which avoids Usd value resolution entirely
+    constexpr int32 NumComponents = std::is_same_v<T, FVector> ? 3 : (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) ? 1 : 0;
+    double Components[3] = {};
+    bool bReadComponents = false;
+
+    // Using the Unreal wrapper of the pxr type VtValue, resolved through the cached attribute query so
+    // that sampling the same attribute at many times doesn't repeat the prim search and value resolve
+    UE::FVtValue Value;
+    if (!GetAnimatedUsdAttributeValue(StageActor, PrimName, AttrName, TimeSample, Components, NumComponents, bReadComponents, Value))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Specified attribute is not holding any value"))
         return T();
     }
 
-    // Using the Unreal wrapper of the pxr type VtValue
-    UE::FVtValue Value;
-    bool bSuccess = Attr.Get(Value, TimeSample);
-
-    if (!bSuccess)
+    if constexpr (NumComponents == 3)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Failed to get animated value for Attribute: %s"), *Attr.GetName().ToString());
-        return T();
+        if (bReadComponents)
+        {
+            return FVector(Components[0], Components[1], Components[2]);
+        }
+    }
+    else if constexpr (NumComponents == 1)
+    {
+        if (bReadComponents)
+        {
+            return static_cast<T>(Components[0]);
+        }
     }
 
     // Required to return the useable type within Unreal
@@ -230,8 +602,7 @@ T UUsdAttributeFunctionLibraryBPLibrary::GetUsdAnimatedAttributeValueInternal(
 template <typename T>
 FVector UUsdAttributeFunctionLibraryBPLibrary::ConvertUsdVectorToFVector(const pxr::VtValue& pxrValue)
 {
-    // Convert the GfVec3f, GfVec3d and GfVec3i into a standard FVector
-    T pxrVec = pxrValue.Get<T>();
-    return FVector(static_cast<double>(pxrVec[0]), static_cast<double>(pxrVec[1]), static_cast<double>(pxrVec[2]));
+    // Convert the GfVec3h, GfVec3f, GfVec3d and GfVec3i into a standard FVector
+    return UsdAttributeTypeRegistry::TUsdValueConverter<T, FVector>::Convert(pxrValue.Get<T>());
 }
 #endif
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeTypes.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/tf/type.h"
+#include "pxr/base/vt/value.h"
+#include "USDIncludesEnd.h"
+#endif
+
+/**
+ * @brief Helpers shared by the baked curves and the attribute samplers to evaluate time samples.
+ *
+ * Sample values are stored as NumComponents doubles per sample: 1 for scalars and 3 for Vec3 attributes.
+ */
+namespace UsdAttributeInterpolation
+{
+    /** The most values stored per sample. */
+    constexpr int32 MaxComponents = 3;
+
+    /**
+     * @brief Remembers the bracket found by the previous search of a list of sample times.
+     *
+     * Playback reads at increasing times usually stay within the previous bracket or move into the
+     * next one, so most searches cost a couple of comparisons rather than a binary search.
+     */
+    struct USDATTRIBUTELIBRARY_API FUsdSampleCursor
+    {
+        /**
+         * @brief Finds the index of the last sample at or before Time, clamped to the first sample.
+         *
+         * @param Times The sample times, in increasing order. Must not be empty.
+         * @param Time The time to search for.
+         * @return The index of the lower sample of the bracket.
+         */
+        int32 FindBracket(TArrayView<const double> Times, double Time);
+
+        /** Forgets the previous bracket, e.g. when the sample times change. */
+        void Reset() { Index = 0; }
+
+    private:
+        int32 Index = 0;
+    };
+
+    /**
+     * @brief Evaluates the values between two samples, holding the lower sample before the first and after the last sample.
+     *
+     * @param Interpolation How values are reconstructed between samples.
+     * @param Times The sample times, in increasing order.
+     * @param Index The lower sample of the bracket, as found by FUsdSampleCursor.
+     * @param Time The time to evaluate at.
+     * @param Neighbours The values of the samples at Index - 1, Index, Index + 1 and Index + 2, or nullptr for samples out of range.
+     *                   Only cubic interpolation reads the outer two, to compute the tangents.
+     * @param NumComponents The number of values per sample.
+     * @param OutComponents Receives NumComponents values.
+     */
+    USDATTRIBUTELIBRARY_API void Evaluate(EUsdAttributeInterpolation Interpolation, TArrayView<const double> Times, int32 Index, double Time,
+        const double* const Neighbours[4], int32 NumComponents, double* OutComponents);
+
+#if USE_USD_SDK
+    /**
+     * @brief Finds the sample layout for an attribute's value type.
+     *
+     * @param ValueType The attribute's value type.
+     * @param bOutCanInterpolate Set to false for types whose values are always held, e.g. ints.
+     * @return The number of values per sample, or 0 if the type can't be sampled.
+     */
+    USDATTRIBUTELIBRARY_API int32 GetNumComponents(const pxr::TfType& ValueType, bool& bOutCanInterpolate);
+
+    /**
+     * @brief Stores a float, double, int or Vec3 value as doubles.
+     *
+     * @param Value The Usd value.
+     * @param OutComponents Receives 1 value for scalars and 3 for Vec3 values.
+     * @return False if the value holds another type.
+     */
+    USDATTRIBUTELIBRARY_API bool ReadComponents(const pxr::VtValue& Value, double* OutComponents);
+#endif
+}
@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if USE_USD_SDK
+#include "UsdPrimNameIndex.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/prim.h"
+#include "UsdWrappers/UsdStage.h"
+#include "USDIncludesEnd.h"
+
+/**
+ * @brief A per-stage inverted index from attribute name to the prims that author an attribute with that name.
+ *
+ * Answers stage wide queries such as "every prim authoring cameraNumber" or "every prim with a custom
+ * attribute matching customColour_*" with a hash lookup, or one pass over the distinct attribute names
+ * for wildcards, rather than walking the stage and asking every prim for its attributes.
+ *
+ * Only attributes with authored opinions are indexed, so schema attributes left at their fallback
+ * values aren't. The index is built in one pass over the stage: prims are listed in traversal order,
+ * then read for their authored attributes in parallel chunks, which are merged back in order so the
+ * paths of each name stay in traversal order. It is kept up to date by FUsdAttributeStageCache in the
+ * same way as FUsdPrimNameIndex.
+ */
+class USDATTRIBUTELIBRARY_API FUsdAttributeNameIndex
+{
+public:
+    /**
+     * @brief Builds the index for the given stage.
+     *
+     * @param Stage The Usd stage to index.
+     */
+    explicit FUsdAttributeNameIndex(const UE::FUsdStage& Stage);
+
+    /**
+     * @brief Finds the prims authoring attributes whose names match a name or a pattern with * and ? wildcards.
+     *
+     * @param AttrName The attribute name or wildcard pattern, e.g. cameraNumber or customColour_*.
+     * @param bCustomOnly Whether to only match custom attributes, e.g. those added by export tools, rather than schema attributes.
+     * @param OutPrimPaths Receives the path of each matching prim, once per matching attribute. Exact names are in traversal
+     *                     order, wildcard matches are sorted by path.
+     * @param OutAttrNames If set, receives the name of the matching attribute for each of OutPrimPaths.
+     */
+    void FindPrimPaths(const FString& AttrName, bool bCustomOnly, TArray<pxr::SdfPath>& OutPrimPaths, TArray<pxr::TfToken>* OutAttrNames = nullptr) const;
+
+    /**
+     * @brief Updates the index after a prim has changed on the stage.
+     *
+     * Adding or removing an attribute resyncs it, so info only changes are ignored.
+     *
+     * @param Stage The Usd stage the index was built from.
+     * @param PrimPath The path of the changed prim or property.
+     * @param bResync Whether the change was a resync.
+     */
+    void HandlePrimChanged(const UE::FUsdStage& Stage, const FString& PrimPath, bool bResync);
+
+    /** @return The number of indexed attributes. */
+    int32 GetNumAttributes() const { return NumAttributes; }
+
+    /** @return The number of distinct attribute names. */
+    int32 GetNumNames() const { return PrimsByAttribute.Num(); }
+
+    /** @return The time taken by the last full build, in seconds. */
+    double GetBuildTimeSeconds() const { return BuildTimeSeconds; }
+
+    /** @return The memory allocated by the index, in bytes. */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FIndexedPrim
+    {
+        pxr::SdfPath Path;
+        bool bCustom = false;
+    };
+
+    /** Rebuilds the whole index from the stage's pseudo root. */
+    void Build(const UE::FUsdStage& Stage);
+
+    /** Adds the authored attributes of the given prims to the index, reading them in parallel. */
+    void IndexPrims(TArrayView<const pxr::UsdPrim> Prims);
+
+    /** Removes the prim at the given path and all of its descendants from the index. */
+    void RemoveSubtree(const pxr::SdfPath& RootPath);
+
+    TMap<pxr::TfToken, TArray<FIndexedPrim>, FDefaultSetAllocator, TUsdTokenKeyFuncs<TArray<FIndexedPrim>>> PrimsByAttribute;
+    int32 NumAttributes = 0;
+    double BuildTimeSeconds = 0.0;
+};
+#endif
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeInterpolation.h"
+#include "UsdAttributeTypes.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/attributeQuery.h"
+#include "USDIncludesEnd.h"
+
+/**
+ * @brief Samples a time sampled attribute at increasing times with a chosen interpolation.
+ *
+ * Unlike reading through Usd, which interpolates with the stage's interpolation type and resolves
+ * the value on every read, the sampler lists the attribute's sample times once and remembers the
+ * bracket found by the previous read. Only the values of the samples around the bracket are read
+ * from Usd, and they are kept while reads stay near them, so sequential playback reads one new
+ * sample per bracket it moves into: amortized O(1) per read. Seeking falls back to a binary search.
+ *
+ * Unlike FUsdBakedAttributeCurve, nothing is read up front beyond the sample times, so a sampler
+ * is cheap to create for long animations that are only partly played.
+ *
+ * Samplers are stateful, so each should only be used from one thread at a time.
+ */
+class USDATTRIBUTELIBRARY_API FUsdAttributeSampler
+{
+public:
+    /**
+     * @brief Creates a sampler for a float, double, int or Vec3 attribute.
+     *
+     * @param InQuery The attribute's query.
+     * @param InInterpolation How values are reconstructed between samples. Int attributes are always held.
+     */
+    FUsdAttributeSampler(const pxr::UsdAttributeQuery& InQuery, EUsdAttributeInterpolation InInterpolation);
+
+    /** @return True if the attribute has a supported type and a value to sample. */
+    bool IsValid() const { return NumComponents > 0; }
+
+    /** @return The number of values per sample: 1 for scalars and 3 for Vec3 attributes. */
+    int32 GetNumComponents() const { return NumComponents; }
+
+    /** @return How values are reconstructed between samples. */
+    EUsdAttributeInterpolation GetInterpolation() const { return Interpolation; }
+
+    /**
+     * @brief Samples the attribute, holding the first and last values outside the sampled range.
+     *
+     * @param Time The time to sample at.
+     * @param OutComponents Receives GetNumComponents() values.
+     * @return False if the sampler isn't valid.
+     */
+    bool Sample(double Time, double* OutComponents);
+
+private:
+    /** The number of sample values kept around the current bracket: one either side of it for the cubic tangents. */
+    static constexpr int32 WindowSize = 4;
+
+    /**
+     * @brief Returns the values of a sample, reading them from Usd unless they are already in the window.
+     *
+     * Samples are kept in the slot given by their index modulo WindowSize, so moving to the next
+     * bracket only replaces the slot of the sample that has fallen out of the window.
+     */
+    const double* GetSampleValues(int32 SampleIndex);
+
+    pxr::UsdAttributeQuery Query;
+    EUsdAttributeInterpolation Interpolation;
+    int32 NumComponents = 0;
+
+    /** The sample times, or a single time for attributes with only a default value. */
+    TArray<double> Times;
+    bool bDefaultValueOnly = false;
+    UsdAttributeInterpolation::FUsdSampleCursor Cursor;
+
+    int32 WindowIndices[WindowSize];
+    double WindowValues[WindowSize][UsdAttributeInterpolation::MaxComponents];
+};
+#endif
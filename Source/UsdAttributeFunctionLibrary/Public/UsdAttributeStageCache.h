@@ -0,0 +1,267 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+#if USE_USD_SDK
+#include "UsdAttributeSampler.h"
+#include "UsdBakedAttributeCurve.h"
+#include "UsdAttributeNameIndex.h"
+#include "UsdPrimNameIndex.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/usd/usd/attributeQuery.h"
+#include "pxr/usd/usd/prim.h"
+#include "UsdWrappers/UsdStage.h"
+#include "USDIncludesEnd.h"
+#endif
+
+class AUsdStageActor;
+
+#if USE_USD_SDK
+/**
+ * @brief Identifies a cached attribute by the prim and attribute names used to request it.
+ *
+ * Usd names are case sensitive, so unlike FString's default comparison both the equality
+ * and the hash here are case sensitive.
+ */
+struct FUsdAttributeCacheKey
+{
+    FString PrimName;
+    FString AttrName;
+
+    bool operator==(const FUsdAttributeCacheKey& Other) const
+    {
+        return PrimName.Equals(Other.PrimName, ESearchCase::CaseSensitive) && AttrName.Equals(Other.AttrName, ESearchCase::CaseSensitive);
+    }
+
+    friend uint32 GetTypeHash(const FUsdAttributeCacheKey& Key)
+    {
+        return HashCombine(FCrc::StrCrc32(*Key.PrimName), FCrc::StrCrc32(*Key.AttrName));
+    }
+};
+
+/**
+ * @brief Lookup state shared by all attribute reads on the stage opened by one UsdStageActor.
+ *
+ * Holds the prim name index and a cache of pxr::UsdAttributeQuery objects keyed by prim and attribute
+ * name. An attribute query keeps the attribute's value resolution info, so sampling the same attribute
+ * at many times only pays for the value fetch rather than the prim search, attribute lookup and
+ * resolve on every call.
+ *
+ * A cache is created per stage actor on first use and bound to its events: opening a new stage
+ * replaces the cache, and any other change drops the queries, samplers and baked curves under the
+ * changed prim. A resync also updates the name index and drops the entries whose prim name now
+ * resolves to a different prim, so baked curves elsewhere on the stage are kept.
+ *
+ * FindOrCreate and the baked curves are game thread only. Once a cache has been found, FindPrim and the
+ * attribute query functions may also be called from worker tasks, as the name index and queries are
+ * guarded by a lock. Worker tasks hold GetWorkerLock for reading for the whole of their read, so that
+ * the prims and queries they resolved aren't dropped from the cache part way through. This only orders
+ * access to the cache: the edit itself has already been made to the stage when its change notice
+ * arrives, so callers must not edit the stage while worker reads are in flight. The name index
+ * is built by the first lookup rather than on creation, so that an async read can take the cost of
+ * indexing a large stage off the game thread.
+ */
+class USDATTRIBUTELIBRARY_API FUsdAttributeStageCache
+{
+public:
+    /**
+     * @brief Returns the cache for the stage currently opened by a stage actor, creating it if required.
+     *
+     * @param StageActor The current UsdStageActor.
+     * @return The stage cache, or nullptr if the actor has no stage opened.
+     */
+    static TSharedPtr<FUsdAttributeStageCache> FindOrCreate(AUsdStageActor* StageActor);
+
+    /**
+     * @brief Drops every cache and unbinds from the stage actors' events. Called on module shutdown.
+     */
+    static void ResetAll();
+
+    /**
+     * @brief Creates the cache for a stage. The name index is built on first use.
+     *
+     * @param InStage The Usd stage to cache lookups for.
+     */
+    explicit FUsdAttributeStageCache(const UE::FUsdStage& InStage);
+
+    /** @return The stage this cache was created for. */
+    const UE::FUsdStage& GetStage() const { return Stage; }
+
+    /**
+     * @brief Returns the prim name index for the stage, building it if required.
+     *
+     * The returned index is only safe to use on the game thread, where it is updated.
+     */
+    const FUsdPrimNameIndex& GetNameIndex() const;
+
+    /**
+     * @brief Returns the attribute name index for the stage, building it if required.
+     *
+     * The returned index is only safe to use on the game thread, where it is updated.
+     */
+    const FUsdAttributeNameIndex& GetAttributeNameIndex() const;
+
+    /**
+     * @brief Finds the first prim matching a prim address.
+     *
+     * Bare names are looked up in the name index and absolute paths directly on the stage. Wildcard and
+     * regular expression addresses are matched as described by FUsdPrimPathPattern.
+     *
+     * @param PrimName The name, path or pattern of the Usd prim.
+     * @return The prim, or an invalid prim if none is found.
+     */
+    pxr::UsdPrim FindPrim(const FString& PrimName) const;
+
+    /**
+     * @brief Finds every prim matching a prim address.
+     *
+     * @param PrimName The name, path or pattern of the Usd prims.
+     * @param OutPaths Receives the matching prim paths. Matches are in traversal order.
+     * @param bFirstOnly Whether to stop at the first match.
+     */
+    void FindPrimPaths(const FString& PrimName, TArray<pxr::SdfPath>& OutPaths, bool bFirstOnly = false) const;
+
+    /**
+     * @brief Finds the prims authoring attributes whose names match a name or wildcard pattern, through the attribute name index.
+     *
+     * @param AttrName The attribute name, or a pattern with * and ? wildcards.
+     * @param bCustomOnly Whether to only match custom attributes.
+     * @param OutPrimPaths Receives the path of each matching prim, once per matching attribute.
+     * @param OutAttrNames If set, receives the name of the matching attribute for each of OutPrimPaths.
+     */
+    void FindPrimPathsWithAttribute(const FString& AttrName, bool bCustomOnly, TArray<pxr::SdfPath>& OutPrimPaths, TArray<pxr::TfToken>* OutAttrNames = nullptr) const;
+
+    /**
+     * @brief Returns the cached query for an attribute, resolving and caching it on first use.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @return The attribute query, which is invalid if the prim or attribute could not be found.
+     */
+    pxr::UsdAttributeQuery FindOrCreateAttributeQuery(const FString& PrimName, const FString& AttrName);
+
+    /**
+     * @brief Returns the cached query for an attribute without resolving it on a miss.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @return The attribute query, which is invalid if the attribute hasn't been cached.
+     */
+    pxr::UsdAttributeQuery FindAttributeQuery(const FString& PrimName, const FString& AttrName) const;
+
+    /**
+     * @brief Resolves and caches the query for an attribute that FindAttributeQuery missed, on a prim the caller has already found.
+     *
+     * Used when reading several attributes from the same prim, so that cache misses don't search for the prim again.
+     *
+     * @param Prim The Usd prim found for PrimName.
+     * @param PrimName The name the prim was requested with.
+     * @param AttrName The name of the attribute.
+     * @return The attribute query, which is invalid if the prim or attribute could not be found.
+     */
+    pxr::UsdAttributeQuery CreateAttributeQuery(const pxr::UsdPrim& Prim, const FString& PrimName, const FString& AttrName);
+
+    /**
+     * @brief Invalidates the cached state affected by a change to the stage.
+     *
+     * @param PrimPath The path of the changed prim.
+     * @param bResync Whether the change was a resync.
+     */
+    void HandlePrimChanged(const FString& PrimPath, bool bResync);
+
+    /**
+     * @brief Returns the lock worker tasks hold for reading while they read through the cache.
+     *
+     * HandlePrimChanged holds it for writing, so the cache isn't invalidated under an in-flight read. It
+     * doesn't protect the read from the edit itself, which the stage has already applied by then.
+     */
+    FRWLock& GetWorkerLock() const { return WorkerLock; }
+
+    /** @return True if the cache was created for the given stage. */
+    bool IsForStage(const UE::FUsdStage& InStage) const { return Stage == InStage; }
+
+    /**
+     * @brief Bakes every time sample of an attribute into a dense curve.
+     *
+     * Float, double, int and Vec3 attributes can be baked. Baked curves are dropped along with the
+     * attribute's cached query when the prim is edited, after which reads fall back to Usd.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the time sampled attribute.
+     * @param Interpolation How values are reconstructed between samples. Int attributes are always held.
+     * @return True if the attribute was found and baked.
+     */
+    bool BakeCurve(const FString& PrimName, const FString& AttrName, EUsdAttributeInterpolation Interpolation);
+
+    /**
+     * @brief Finds the baked curve for an attribute.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @return The curve, or nullptr if the attribute hasn't been baked.
+     */
+    const FUsdBakedAttributeCurve* FindBakedCurve(const FString& PrimName, const FString& AttrName) const
+    {
+        return BakedCurves.Find(FUsdAttributeCacheKey{ PrimName, AttrName });
+    }
+
+    /** Drops every baked curve. */
+    void ClearBakedCurves() { BakedCurves.Reset(); }
+
+    /** Sets whether the animated getters read from the baked curves. */
+    void SetUseBakedCurves(bool bInUseBakedCurves) { bUseBakedCurves = bInUseBakedCurves; }
+
+    /** @return True if the animated getters read from the baked curves. */
+    bool IsUsingBakedCurves() const { return bUseBakedCurves; }
+
+    /**
+     * @brief Sets how the animated getters interpolate an attribute, instead of reading it through Usd.
+     *
+     * The attribute is then read through an FUsdAttributeSampler, which is kept across reads so that
+     * playback only reads the samples it moves into. The choice outlives edits to the prim, which only
+     * drop the sampler's state.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @param Interpolation How values are reconstructed between samples, or unset to read through Usd again.
+     */
+    void SetInterpolation(const FString& PrimName, const FString& AttrName, TOptional<EUsdAttributeInterpolation> Interpolation);
+
+    /** @return True if an interpolation has been set for any attribute, so some reads may go through a sampler. */
+    bool HasInterpolations() const { return !Interpolations.IsEmpty(); }
+
+    /**
+     * @brief Returns the sampler for an attribute whose interpolation has been set, creating it if required.
+     *
+     * @param Query The attribute's query, as returned by FindOrCreateAttributeQuery, which a new sampler reads from.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @return The sampler, or nullptr if no interpolation was set or the attribute can't be sampled.
+     */
+    FUsdAttributeSampler* FindOrCreateSampler(const pxr::UsdAttributeQuery& Query, const FString& PrimName, const FString& AttrName);
+
+private:
+    UE::FUsdStage Stage;
+
+    /** Held for reading by worker tasks for a whole read, and for writing while handling edits. Always taken before Lock. */
+    mutable FRWLock WorkerLock;
+
+    /** Guards NameIndex, AttributeNameIndex and AttributeQueries, which are read from worker tasks by the async getters. */
+    mutable FRWLock Lock;
+    mutable TUniquePtr<FUsdPrimNameIndex> NameIndex;
+    mutable TUniquePtr<FUsdAttributeNameIndex> AttributeNameIndex;
+    TMap<FUsdAttributeCacheKey, pxr::UsdAttributeQuery> AttributeQueries;
+
+    /** Baked curves are only kept for attributes that also have a cached query, so they're invalidated together. */
+    TMap<FUsdAttributeCacheKey, FUsdBakedAttributeCurve> BakedCurves;
+    bool bUseBakedCurves = false;
+
+    /** Like the baked curves, samplers are dropped with their attribute's cached query and are game thread only. */
+    TMap<FUsdAttributeCacheKey, EUsdAttributeInterpolation> Interpolations;
+    TMap<FUsdAttributeCacheKey, FUsdAttributeSampler> Samplers;
+};
+#endif
@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+#include <atomic>
+
+/**
+ * Per call latency tracking costs two cycle counter reads and a few atomic increments per read,
+ * so it is compiled out of shipping builds unless USDATTRIBUTES_ENABLE_STATS is defined.
+ */
+#ifndef USDATTRIBUTES_ENABLE_STATS
+#define USDATTRIBUTES_ENABLE_STATS !UE_BUILD_SHIPPING
+#endif
+
+DECLARE_STATS_GROUP(TEXT("UsdAttributes"), STATGROUP_UsdAttributes, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdVec3Attribute"), STAT_UsdAttributes_Vec3, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdFloatAttribute"), STAT_UsdAttributes_Float, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdDoubleAttribute"), STAT_UsdAttributes_Double, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdIntAttribute"), STAT_UsdAttributes_Int, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAnimatedVec3Attribute"), STAT_UsdAttributes_AnimatedVec3, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAnimatedFloatAttribute"), STAT_UsdAttributes_AnimatedFloat, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAnimatedDoubleAttribute"), STAT_UsdAttributes_AnimatedDouble, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAnimatedIntAttribute"), STAT_UsdAttributes_AnimatedInt, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsd...Attribute (other types)"), STAT_UsdAttributes_Other, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAnimated...Attribute (other types)"), STAT_UsdAttributes_AnimatedOther, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsd...ArrayAttribute"), STAT_UsdAttributes_Array, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAttributesBatch"), STAT_UsdAttributes_Batch, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetUsdAnimatedAttributeRange"), STAT_UsdAttributes_Range, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UsdAttributeBindings"), STAT_UsdAttributes_Bindings, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lookup misses"), STAT_UsdAttributes_LookupMisses, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query cache hits"), STAT_UsdAttributes_QueryCacheHits, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query cache misses"), STAT_UsdAttributes_QueryCacheMisses, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Baked curve reads"), STAT_UsdAttributes_BakedCurveReads, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sampler reads"), STAT_UsdAttributes_SamplerReads, STATGROUP_UsdAttributes, USDATTRIBUTELIBRARY_API);
+
+/**
+ * @brief The getters whose calls and latencies are tracked. Names match the STAT_UsdAttributes_ cycle stats.
+ */
+enum class EUsdAttributeGetter : uint8
+{
+    Vec3,
+    Float,
+    Double,
+    Int,
+    AnimatedVec3,
+    AnimatedFloat,
+    AnimatedDouble,
+    AnimatedInt,
+    /** The bool, Vec2, Vec4, quaternion, matrix, string and color getters. */
+    Other,
+    AnimatedOther,
+    /** The array getters, static and animated. */
+    Array,
+    Batch,
+    Range,
+    /** One evaluation of every UsdAttributeBindingComponent in a world. */
+    Bindings,
+    Num
+};
+
+/**
+ * @brief The lookup events that are counted. Names match the STAT_UsdAttributes_ counter stats.
+ */
+enum class EUsdAttributeCounter : uint8
+{
+    LookupMisses,
+    QueryCacheHits,
+    QueryCacheMisses,
+    BakedCurveReads,
+    SamplerReads,
+    Num
+};
+
+/**
+ * @brief Session totals for the attribute library, complementing the per frame `stat UsdAttributes` group.
+ *
+ * Records the call count and a latency histogram for every getter, along with lookup counters, so that
+ * average and percentile latencies and cache hit rates can be dumped with the UsdAttributes.DumpStats
+ * console command. Histogram buckets are powers of two nanoseconds, so percentiles are upper bounds
+ * accurate to within a factor of two. Recording is lock free and can happen from any thread.
+ */
+class USDATTRIBUTELIBRARY_API FUsdAttributeStats
+{
+public:
+    /** @return The stats for the attribute library. */
+    static FUsdAttributeStats& Get();
+
+    /**
+     * @brief Records one call to a getter.
+     *
+     * @param Getter The getter that was called.
+     * @param Cycles The duration of the call, in platform cycles.
+     */
+    void RecordCall(EUsdAttributeGetter Getter, uint64 Cycles);
+
+    /**
+     * @brief Increments one of the lookup counters.
+     *
+     * @param Counter The counter to increment.
+     */
+    void IncrementCounter(EUsdAttributeCounter Counter)
+    {
+        Counters[static_cast<int32>(Counter)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Writes a table of calls, latencies and hit rates.
+     *
+     * @param Ar The output device to write to.
+     */
+    void Dump(FOutputDevice& Ar) const;
+
+    /** Clears every recorded call and counter. */
+    void Reset();
+
+private:
+    static constexpr int32 NumBuckets = 40;
+
+    struct FGetterStats
+    {
+        std::atomic<uint64> Calls{ 0 };
+        std::atomic<uint64> TotalCycles{ 0 };
+        std::atomic<uint64> Buckets[NumBuckets] = {};
+    };
+
+    /** @return An upper bound on the latency, in nanoseconds, below which the given fraction of calls completed. */
+    static double GetPercentileNanoseconds(const FGetterStats& Stats, double Fraction);
+
+    FGetterStats Getters[static_cast<int32>(EUsdAttributeGetter::Num)];
+    std::atomic<uint64> Counters[static_cast<int32>(EUsdAttributeCounter::Num)] = {};
+};
+
+/**
+ * @brief Records the duration of the enclosing scope as one call to a getter.
+ */
+struct FUsdAttributeScopedCall
+{
+    explicit FUsdAttributeScopedCall(EUsdAttributeGetter InGetter)
+        : Getter(InGetter)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FUsdAttributeScopedCall()
+    {
+        FUsdAttributeStats::Get().RecordCall(Getter, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+    EUsdAttributeGetter Getter;
+    uint64 StartCycles;
+};
+
+#if USDATTRIBUTES_ENABLE_STATS
+#define USD_ATTRIBUTE_SCOPE_CALL(Getter) \
+    SCOPE_CYCLE_COUNTER(STAT_UsdAttributes_##Getter); \
+    FUsdAttributeScopedCall UsdAttributeScopedCall_##Getter(EUsdAttributeGetter::Getter)
+#define USD_ATTRIBUTE_INC_COUNTER(Counter) \
+    INC_DWORD_STAT(STAT_UsdAttributes_##Counter); \
+    FUsdAttributeStats::Get().IncrementCounter(EUsdAttributeCounter::Counter)
+#else
+#define USD_ATTRIBUTE_SCOPE_CALL(Getter) SCOPE_CYCLE_COUNTER(STAT_UsdAttributes_##Getter)
+#define USD_ATTRIBUTE_INC_COUNTER(Counter) INC_DWORD_STAT(STAT_UsdAttributes_##Counter)
+#endif
@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeTypes.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/vt/value.h"
+#include "USDIncludesEnd.h"
+
+class AUsdStageActor;
+
+/** Called with an attribute's new value when it changes. */
+DECLARE_DELEGATE_OneParam(FOnUsdAttributeChanged, const pxr::VtValue& /*Value*/);
+
+/**
+ * @brief Notifies subscribers when the value of a (prim, attribute) pair changes.
+ *
+ * Rather than polling an attribute every tick, a subscriber is called once with the current value and
+ * then only when the value it would read changes, either because the stage was edited or because the
+ * stage actor's time moved into a different time sample.
+ *
+ * Each subscription remembers the interval of time around its last read over which the value is known
+ * to be constant: everything for attributes that aren't time varying, the span between two samples for
+ * held attributes, and the span before the first and after the last sample. Time changes inside that
+ * interval are skipped without touching Usd, so only subscriptions that may actually change are read.
+ *
+ * Stage edits reach the subscriptions through AUsdStageActor::OnPrimChanged, which forwards the stage's
+ * UsdNotice::ObjectsChanged. The affected subscriptions are read again on the next tick, once the stage
+ * cache has dropped its stale queries and a burst of edits has been coalesced.
+ *
+ * Game thread only.
+ */
+class USDATTRIBUTELIBRARY_API FUsdAttributeSubscriptions
+{
+public:
+    /** @return The subscription manager. */
+    static FUsdAttributeSubscriptions& Get();
+
+    /**
+     * @brief Subscribes to changes of an attribute's value.
+     *
+     * The delegate is called straight away if the attribute has a value, and with an empty value if the
+     * attribute is later removed. It is dropped once it is unbound, e.g. when the object it was bound to
+     * with CreateUObject or CreateWeakLambda is destroyed.
+     *
+     * @param StageActor The current UsdStageActor.
+     * @param PrimName The name of the Usd prim.
+     * @param AttrName The name of the attribute.
+     * @param OnChanged Called with the attribute's value whenever it changes.
+     * @return The handle to unsubscribe with, which is invalid if the stage actor is null.
+     */
+    FUsdAttributeSubscriptionHandle Subscribe(AUsdStageActor* StageActor, const FString& PrimName, const FString& AttrName, FOnUsdAttributeChanged OnChanged);
+
+    /**
+     * @brief Removes a subscription. Does nothing if the handle is invalid or was already removed.
+     *
+     * @param Handle The handle returned by Subscribe.
+     */
+    void Unsubscribe(FUsdAttributeSubscriptionHandle Handle);
+
+    /** @return The number of active subscriptions. */
+    int32 Num() const;
+
+    /** Drops every subscription and unbinds from the stage actors' events. Called on module shutdown. */
+    void Reset();
+
+private:
+    FUsdAttributeSubscriptions() = default;
+};
+#endif
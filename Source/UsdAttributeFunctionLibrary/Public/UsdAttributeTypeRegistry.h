@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeTypes.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/gf/half.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/matrix4f.h"
+#include "pxr/base/gf/quatd.h"
+#include "pxr/base/gf/quatf.h"
+#include "pxr/base/gf/quath.h"
+#include "pxr/base/gf/vec2d.h"
+#include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec2h.h"
+#include "pxr/base/gf/vec2i.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec3h.h"
+#include "pxr/base/gf/vec3i.h"
+#include "pxr/base/gf/vec4d.h"
+#include "pxr/base/gf/vec4f.h"
+#include "pxr/base/gf/vec4h.h"
+#include "pxr/base/gf/vec4i.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/base/vt/types.h"
+#include "pxr/base/vt/value.h"
+#include "pxr/usd/sdf/assetPath.h"
+#include "USDIncludesEnd.h"
+
+#include <string>
+
+/**
+ * @brief Compile time table of the conversions from Usd value types to the Unreal types the getters return.
+ *
+ * Every supported (Usd type, Unreal type) pair is a TUsdValueConverter specialisation declared with
+ * USD_ATTRIBUTE_VALUE_CONVERTER. ConvertUsdValue dispatches on the value's Vt known type index with a
+ * single switch, and the conversions that don't exist for the requested Unreal type compile down to a
+ * type mismatch. Supporting a new type is one converter line here plus, for a Usd type that isn't
+ * already listed, one entry in USD_ATTRIBUTE_KNOWN_VALUE_TYPES.
+ */
+namespace UsdAttributeTypeRegistry
+{
+    /** Converts a Usd value type to an Unreal type. Convert is only defined for the specialised pairs. */
+    template <typename UsdType, typename UnrealType>
+    struct TUsdValueConverter
+    {
+        static constexpr bool bSupported = false;
+    };
+
+#define USD_ATTRIBUTE_VALUE_CONVERTER(UsdType, UnrealType, Expression) \
+    template <> \
+    struct TUsdValueConverter<UsdType, UnrealType> \
+    { \
+        static constexpr bool bSupported = true; \
+        static UnrealType Convert(const UsdType& Value) { return Expression; } \
+    };
+
+    template <typename GfMatrix>
+    FMatrix ConvertMatrix(const GfMatrix& Value)
+    {
+        // Gf and Unreal matrices both transform row vectors, so the elements map across directly
+        FMatrix Matrix;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Matrix.M[Row][Column] = static_cast<double>(Value[Row][Column]);
+            }
+        }
+        return Matrix;
+    }
+
+    template <typename GfQuat>
+    FQuat ConvertQuat(const GfQuat& Value)
+    {
+        const auto& Imaginary = Value.GetImaginary();
+        return FQuat(static_cast<double>(Imaginary[0]), static_cast<double>(Imaginary[1]), static_cast<double>(Imaginary[2]), static_cast<double>(Value.GetReal()));
+    }
+
+    inline FString ConvertAssetPath(const pxr::SdfAssetPath& Value)
+    {
+        const std::string& Path = Value.GetResolvedPath().empty() ? Value.GetAssetPath() : Value.GetResolvedPath();
+        return FString(UTF8_TO_TCHAR(Path.c_str()));
+    }
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(bool, bool, Value)
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(int, int32, Value)
+    USD_ATTRIBUTE_VALUE_CONVERTER(unsigned char, int32, static_cast<int32>(Value))
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfHalf, float, static_cast<float>(Value))
+    USD_ATTRIBUTE_VALUE_CONVERTER(float, float, Value)
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfHalf, double, static_cast<double>(static_cast<float>(Value)))
+    USD_ATTRIBUTE_VALUE_CONVERTER(float, double, static_cast<double>(Value))
+    USD_ATTRIBUTE_VALUE_CONVERTER(double, double, Value)
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec2h, FVector2D, FVector2D(static_cast<float>(Value[0]), static_cast<float>(Value[1])))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec2f, FVector2D, FVector2D(Value[0], Value[1]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec2d, FVector2D, FVector2D(Value[0], Value[1]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec2i, FVector2D, FVector2D(Value[0], Value[1]))
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3h, FVector, FVector(static_cast<float>(Value[0]), static_cast<float>(Value[1]), static_cast<float>(Value[2])))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3f, FVector, FVector(Value[0], Value[1], Value[2]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3d, FVector, FVector(Value[0], Value[1], Value[2]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3i, FVector, FVector(Value[0], Value[1], Value[2]))
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4h, FVector4, FVector4(static_cast<float>(Value[0]), static_cast<float>(Value[1]), static_cast<float>(Value[2]), static_cast<float>(Value[3])))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4f, FVector4, FVector4(Value[0], Value[1], Value[2], Value[3]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4d, FVector4, FVector4(Value[0], Value[1], Value[2], Value[3]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4i, FVector4, FVector4(Value[0], Value[1], Value[2], Value[3]))
+
+    // color3 and color4 attributes are Vec3 and Vec4 values with a color role
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3h, FLinearColor, FLinearColor(static_cast<float>(Value[0]), static_cast<float>(Value[1]), static_cast<float>(Value[2])))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3f, FLinearColor, FLinearColor(Value[0], Value[1], Value[2]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec3d, FLinearColor, FLinearColor(static_cast<float>(Value[0]), static_cast<float>(Value[1]), static_cast<float>(Value[2])))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4h, FLinearColor, FLinearColor(static_cast<float>(Value[0]), static_cast<float>(Value[1]), static_cast<float>(Value[2]), static_cast<float>(Value[3])))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4f, FLinearColor, FLinearColor(Value[0], Value[1], Value[2], Value[3]))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfVec4d, FLinearColor, FLinearColor(static_cast<float>(Value[0]), static_cast<float>(Value[1]), static_cast<float>(Value[2]), static_cast<float>(Value[3])))
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfQuath, FQuat, ConvertQuat(Value))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfQuatf, FQuat, ConvertQuat(Value))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfQuatd, FQuat, ConvertQuat(Value))
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfMatrix4f, FMatrix, ConvertMatrix(Value))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::GfMatrix4d, FMatrix, ConvertMatrix(Value))
+
+    USD_ATTRIBUTE_VALUE_CONVERTER(std::string, FString, FString(UTF8_TO_TCHAR(Value.c_str())))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::TfToken, FString, FString(UTF8_TO_TCHAR(Value.GetText())))
+    USD_ATTRIBUTE_VALUE_CONVERTER(pxr::SdfAssetPath, FString, ConvertAssetPath(Value))
+
+#undef USD_ATTRIBUTE_VALUE_CONVERTER
+
+/** The Usd types with converters that Vt has a known type index for, i.e. every one except SdfAssetPath. */
+#define USD_ATTRIBUTE_KNOWN_VALUE_TYPES(Op) \
+    Op(bool) Op(unsigned char) Op(int) Op(pxr::GfHalf) Op(float) Op(double) \
+    Op(pxr::GfVec2h) Op(pxr::GfVec2f) Op(pxr::GfVec2d) Op(pxr::GfVec2i) \
+    Op(pxr::GfVec3h) Op(pxr::GfVec3f) Op(pxr::GfVec3d) Op(pxr::GfVec3i) \
+    Op(pxr::GfVec4h) Op(pxr::GfVec4f) Op(pxr::GfVec4d) Op(pxr::GfVec4i) \
+    Op(pxr::GfQuath) Op(pxr::GfQuatf) Op(pxr::GfQuatd) \
+    Op(pxr::GfMatrix4f) Op(pxr::GfMatrix4d) \
+    Op(std::string) Op(pxr::TfToken)
+
+    /** Converts a value already known to hold a UsdType, failing if there is no conversion to UnrealType. */
+    template <typename UsdType, typename UnrealType>
+    bool ConvertHeldUsdValue(const pxr::VtValue& Value, UnrealType& OutValue)
+    {
+        if constexpr (TUsdValueConverter<UsdType, UnrealType>::bSupported)
+        {
+            OutValue = TUsdValueConverter<UsdType, UnrealType>::Convert(Value.UncheckedGet<UsdType>());
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Converts a resolved Usd value to an Unreal type.
+     *
+     * @param Value The resolved Usd value.
+     * @param OutValue Receives the converted value.
+     * @return False if the value is empty or its type has no conversion to UnrealType.
+     */
+    template <typename UnrealType>
+    bool ConvertUsdValue(const pxr::VtValue& Value, UnrealType& OutValue)
+    {
+        switch (Value.GetKnownValueTypeIndex())
+        {
+#define USD_ATTRIBUTE_CONVERT_KNOWN_TYPE(UsdType) \
+        case pxr::VtGetKnownValueTypeIndex<UsdType>(): \
+            return ConvertHeldUsdValue<UsdType>(Value, OutValue);
+
+        USD_ATTRIBUTE_KNOWN_VALUE_TYPES(USD_ATTRIBUTE_CONVERT_KNOWN_TYPE)
+
+#undef USD_ATTRIBUTE_CONVERT_KNOWN_TYPE
+        default:
+            break;
+        }
+
+        // Types without a known type index have to be checked one by one
+        if (Value.IsHolding<pxr::SdfAssetPath>())
+        {
+            return ConvertHeldUsdValue<pxr::SdfAssetPath>(Value, OutValue);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Stores a resolved value in an attribute result as the requested type.
+     *
+     * @param PxrValue The resolved Usd value.
+     * @param Type The type the value was requested as.
+     * @param OutResult The result to fill in.
+     */
+    inline void ConvertUsdValueToResult(const pxr::VtValue& PxrValue, EUsdAttributeValueType Type, FUsdAttributeResult& OutResult)
+    {
+        using UsdAttributeTypeRegistry::ConvertUsdValue;
+
+        bool bConverted = false;
+        switch (Type)
+        {
+        case EUsdAttributeValueType::Float:  bConverted = ConvertUsdValue(PxrValue, OutResult.FloatValue); break;
+        case EUsdAttributeValueType::Double: bConverted = ConvertUsdValue(PxrValue, OutResult.DoubleValue); break;
+        case EUsdAttributeValueType::Int:    bConverted = ConvertUsdValue(PxrValue, OutResult.IntValue); break;
+        case EUsdAttributeValueType::Vec3:   bConverted = ConvertUsdValue(PxrValue, OutResult.VectorValue); break;
+        case EUsdAttributeValueType::Bool:   bConverted = ConvertUsdValue(PxrValue, OutResult.BoolValue); break;
+        case EUsdAttributeValueType::Vec2:   bConverted = ConvertUsdValue(PxrValue, OutResult.Vector2DValue); break;
+        case EUsdAttributeValueType::Vec4:   bConverted = ConvertUsdValue(PxrValue, OutResult.Vector4Value); break;
+        case EUsdAttributeValueType::Quat:   bConverted = ConvertUsdValue(PxrValue, OutResult.QuatValue); break;
+        case EUsdAttributeValueType::Matrix: bConverted = ConvertUsdValue(PxrValue, OutResult.MatrixValue); break;
+        case EUsdAttributeValueType::String: bConverted = ConvertUsdValue(PxrValue, OutResult.StringValue); break;
+        case EUsdAttributeValueType::Color:  bConverted = ConvertUsdValue(PxrValue, OutResult.ColorValue); break;
+        }
+
+        OutResult.Status = bConverted ? EUsdAttributeStatus::Success : EUsdAttributeStatus::TypeMismatch;
+    }
+}
+#endif
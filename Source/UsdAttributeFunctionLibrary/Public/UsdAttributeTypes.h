@@ -0,0 +1,239 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeTypes.generated.h"
+
+/**
+ * @brief The Unreal value types that Usd attributes can be read as.
+ */
+UENUM(BlueprintType)
+enum class EUsdAttributeValueType : uint8
+{
+    Float,
+    Double,
+    Int,
+    Vec3,
+    Bool,
+    Vec2,
+    Vec4,
+    Quat,
+    Matrix,
+    /** Read from string, token and asset attributes. */
+    String,
+    /** Read from color3 and color4 attributes, or any other Vec3 and Vec4 attribute. */
+    Color
+};
+
+/**
+ * @brief The outcome of reading a single attribute.
+ */
+UENUM(BlueprintType)
+enum class EUsdAttributeStatus : uint8
+{
+    Success,
+    StageNotFound,
+    PrimNotFound,
+    AttributeNotFound,
+    NoValue,
+    TypeMismatch
+};
+
+/**
+ * @brief How values are reconstructed between the time samples of a baked curve or attribute sampler.
+ */
+UENUM(BlueprintType)
+enum class EUsdAttributeInterpolation : uint8
+{
+    /** Holds the value of the previous time sample. */
+    Held,
+    /** Linearly interpolates between the bracketing time samples. */
+    Linear,
+    /** Interpolates with a cubic Hermite spline through the samples, taking tangents from the neighbouring samples. */
+    Cubic
+};
+
+/**
+ * @brief How Vec3 array attributes are converted from the stage's axes and units to Unreal's.
+ */
+UENUM(BlueprintType)
+enum class EUsdVectorConversion : uint8
+{
+    /** Values are returned as authored. */
+    None,
+    /** Positions such as points, converted to Unreal's Z up axes and scaled from the stage's metersPerUnit to centimeters. */
+    Position,
+    /** Directions such as normals, converted to Unreal's Z up axes without scaling. */
+    Direction
+};
+
+/**
+ * @brief What a UsdAttributeBindingComponent writes a bound attribute value to.
+ */
+UENUM(BlueprintType)
+enum class EUsdAttributeBindingTarget : uint8
+{
+    /** A property of the owning actor or one of its components, found by a property path. */
+    Property,
+    /** A scalar parameter of a dynamic material instance, read from a float attribute. */
+    ScalarMaterialParameter,
+    /** A vector parameter of a dynamic material instance, read from a color or other Vec3 or Vec4 attribute. */
+    VectorMaterialParameter
+};
+
+/**
+ * @brief A single attribute read for GetUsdAttributesBatch.
+ */
+USTRUCT(BlueprintType)
+struct USDATTRIBUTELIBRARY_API FUsdAttributeRequest
+{
+    GENERATED_BODY()
+
+    /** The name, absolute path or pattern of the Usd prim, see FindUsdPrimPaths. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    FString PrimName;
+
+    /** The name of the attribute to retrieve. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    FString AttrName;
+
+    /** The type the attribute value should be read as. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    EUsdAttributeValueType Type = EUsdAttributeValueType::Float;
+
+    /** Whether to read the value at TimeSample, otherwise the default value is read as with the non animated getters. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    bool bAnimated = true;
+
+    /** The time sample to read the value at. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    double TimeSample = 0.0;
+};
+
+/**
+ * @brief The result of a single attribute read from GetUsdAttributesBatch.
+ *
+ * Only the value matching the requested type is set.
+ */
+USTRUCT(BlueprintType)
+struct USDATTRIBUTELIBRARY_API FUsdAttributeResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    EUsdAttributeStatus Status = EUsdAttributeStatus::NoValue;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    float FloatValue = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    double DoubleValue = 0.0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    int32 IntValue = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FVector VectorValue = FVector::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    bool BoolValue = false;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FVector2D Vector2DValue = FVector2D::ZeroVector;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FVector4 Vector4Value = FVector4(0.0, 0.0, 0.0, 0.0);
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FQuat QuatValue = FQuat::Identity;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FMatrix MatrixValue = FMatrix::Identity;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FString StringValue;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UsdAttributes")
+    FLinearColor ColorValue = FLinearColor::Black;
+};
+
+/**
+ * @brief An attribute to bake into a dense curve with BakeUsdAttributeCurves.
+ */
+USTRUCT(BlueprintType)
+struct USDATTRIBUTELIBRARY_API FUsdAttributeCurveRequest
+{
+    GENERATED_BODY()
+
+    /** The name of the Usd prim. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    FString PrimName;
+
+    /** The name of the time sampled attribute to bake. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    FString AttrName;
+
+    /** How values are reconstructed between time samples. Int attributes are always held. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    EUsdAttributeInterpolation Interpolation = EUsdAttributeInterpolation::Linear;
+};
+
+/**
+ * @brief Identifies an attribute subscription made with SubscribeToUsdAttribute.
+ */
+USTRUCT(BlueprintType)
+struct USDATTRIBUTELIBRARY_API FUsdAttributeSubscriptionHandle
+{
+    GENERATED_BODY()
+
+    /** Zero for a handle that doesn't refer to a subscription. */
+    UPROPERTY()
+    int64 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+
+    bool operator==(const FUsdAttributeSubscriptionHandle& Other) const { return Id == Other.Id; }
+
+    friend uint32 GetTypeHash(const FUsdAttributeSubscriptionHandle& Handle) { return GetTypeHash(Handle.Id); }
+};
+
+/**
+ * @brief Binds a Usd attribute to a property or material parameter, see UUsdAttributeBindingComponent.
+ */
+USTRUCT(BlueprintType)
+struct USDATTRIBUTELIBRARY_API FUsdAttributeBinding
+{
+    GENERATED_BODY()
+
+    /** The name of the Usd prim. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    FString PrimName;
+
+    /** The name of the attribute to read at the stage actor's current time. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    FString AttrName;
+
+    /** What the value is written to. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes")
+    EUsdAttributeBindingTarget Target = EUsdAttributeBindingTarget::Property;
+
+    /**
+     * The path of the property to write from the owning actor, e.g. LightComponent.Intensity or
+     * RootComponent.RelativeLocation. The first name may also be the name of one of the actor's components.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes", meta = (EditCondition = "Target == EUsdAttributeBindingTarget::Property"))
+    FString PropertyPath;
+
+    /** The name of the primitive component whose material is written, or None for the first primitive component. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes", meta = (EditCondition = "Target != EUsdAttributeBindingTarget::Property"))
+    FName ComponentName;
+
+    /** The material slot, which is given a dynamic material instance if it doesn't already have one. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes", meta = (EditCondition = "Target != EUsdAttributeBindingTarget::Property"))
+    int32 MaterialIndex = 0;
+
+    /** The name of the material parameter to write. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UsdAttributes", meta = (EditCondition = "Target != EUsdAttributeBindingTarget::Property"))
+    FName ParameterName;
+};
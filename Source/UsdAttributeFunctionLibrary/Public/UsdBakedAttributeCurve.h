@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UsdAttributeInterpolation.h"
+#include "UsdAttributeTypes.h"
+
+/**
+ * @brief The time samples of one attribute baked into contiguous arrays for fast runtime playback.
+ *
+ * Times and values are stored as a structure of arrays: Times holds every sample time in increasing
+ * order, and Values holds NumComponents doubles per sample (1 for scalars, 3 for Vec3 attributes).
+ * Evaluating the curve finds the bracketing samples starting from where the previous evaluation
+ * stopped, so reads at increasing times during playback don't search the whole curve, and never
+ * call into Usd value resolution.
+ *
+ * The cursor makes evaluation stateful, so a curve should only be evaluated from the game thread.
+ */
+struct USDATTRIBUTELIBRARY_API FUsdBakedAttributeCurve
+{
+    /** The sample times, in increasing order. */
+    TArray<double> Times;
+
+    /** NumComponents values per sample time. */
+    TArray<double> Values;
+
+    /** The number of values stored per sample time. */
+    int32 NumComponents = 1;
+
+    /** How values are reconstructed between samples. */
+    EUsdAttributeInterpolation Interpolation = EUsdAttributeInterpolation::Linear;
+
+    /**
+     * @brief Evaluates the curve, holding the first and last values outside the baked range.
+     *
+     * @param Time The time to evaluate the curve at.
+     * @param OutComponents Receives NumComponents values.
+     * @return False if the curve holds no samples.
+     */
+    bool Evaluate(double Time, double* OutComponents) const;
+
+    /** @return The memory allocated by the curve, in bytes. */
+    SIZE_T GetAllocatedSize() const { return Times.GetAllocatedSize() + Values.GetAllocatedSize(); }
+
+private:
+    /** The bracket found by the previous evaluation. */
+    mutable UsdAttributeInterpolation::FUsdSampleCursor Cursor;
+};
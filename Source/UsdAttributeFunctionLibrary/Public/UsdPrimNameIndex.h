@@ -0,0 +1,147 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if USE_USD_SDK
+#include "USDIncludesStart.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/prim.h"
+#include "UsdWrappers/SdfPath.h"
+#include "UsdWrappers/UsdStage.h"
+#include "USDIncludesEnd.h"
+#endif
+
+#if USE_USD_SDK
+/**
+ * @brief Key functions allowing pxr::TfToken to be used as a TMap key.
+ *
+ * Tokens compare by pointer, so this keeps lookups case sensitive and avoids
+ * converting prim names to FString when the index is built.
+ */
+template <typename ValueType>
+struct TUsdTokenKeyFuncs : TDefaultMapKeyFuncs<pxr::TfToken, ValueType, false>
+{
+    static FORCEINLINE uint32 GetKeyHash(const pxr::TfToken& Key)
+    {
+        return GetTypeHash(static_cast<uint64>(Key.Hash()));
+    }
+};
+
+/**
+ * @brief Key functions allowing pxr::SdfPath to be used as a TMap key.
+ */
+template <typename ValueType>
+struct TUsdPathKeyFuncs : TDefaultMapKeyFuncs<pxr::SdfPath, ValueType, false>
+{
+    static FORCEINLINE uint32 GetKeyHash(const pxr::SdfPath& Key)
+    {
+        return GetTypeHash(static_cast<uint64>(Key.GetHash()));
+    }
+};
+
+/**
+ * @brief A per-stage index from prim name to the SdfPaths of the prims using that name.
+ *
+ * Replaces the depth first search from the pseudo root that GetSdfPathWithName performs, so that
+ * finding a prim by name is a single hash lookup. The index is built with one traversal of the stage
+ * and is kept up to date by FUsdAttributeStageCache from the stage actor's change notifications: a
+ * resync re-indexes only the affected subtree, and a stage reload builds a new index.
+ *
+ * Prim names are not unique within a stage, so every name keeps all of its paths in traversal order.
+ * FindPrimPath returns the first of these, which is the prim the recursive search would have found.
+ * Re-indexed prims are inserted where the traversal would visit them, so the order holds across edits.
+ * A reverse index from path to name and children lets a subtree be removed without visiting every name.
+ */
+class USDATTRIBUTELIBRARY_API FUsdPrimNameIndex
+{
+public:
+    /**
+     * @brief Builds the index for the given stage.
+     *
+     * @param Stage The Usd stage to index.
+     */
+    explicit FUsdPrimNameIndex(const UE::FUsdStage& Stage);
+
+    /**
+     * @brief Finds the path of the first prim with the given name.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @param OutPath The path of the prim if found.
+     * @return True if a prim with that name exists on the stage.
+     */
+    bool FindPrimPath(const FString& PrimName, UE::FSdfPath& OutPath) const;
+
+    /**
+     * @brief Finds the paths of every prim with the given name, in traversal order.
+     *
+     * @param PrimName The name of the Usd prim.
+     * @return The prim paths, or nullptr if no prim has that name.
+     */
+    const TArray<pxr::SdfPath>* FindPrimPaths(const FString& PrimName) const;
+
+    /**
+     * @brief Finds the paths of every prim whose name passes a predicate, e.g. a wildcard match.
+     *
+     * Visits each distinct name once rather than each prim.
+     *
+     * @param Stage The Usd stage the index was built from, used to merge the names' paths in traversal order.
+     * @param Predicate Called with each indexed name.
+     * @param OutPaths Receives the paths of the prims with matching names, in traversal order.
+     */
+    void FindPrimPathsMatching(const UE::FUsdStage& Stage, TFunctionRef<bool(const pxr::TfToken&)> Predicate, TArray<pxr::SdfPath>& OutPaths) const;
+
+    /**
+     * @brief Updates the index after a prim has changed on the stage.
+     *
+     * Only resyncs can add, remove or rename prims, so info only changes are ignored.
+     *
+     * @param Stage The Usd stage the index was built from.
+     * @param PrimPath The path of the changed prim.
+     * @param bResync Whether the change was a resync.
+     */
+    void HandlePrimChanged(const UE::FUsdStage& Stage, const FString& PrimPath, bool bResync);
+
+    /** @return True if the index was built from the given stage. */
+    bool IsForStage(const UE::FUsdStage& Stage) const;
+
+    /** @return The number of indexed prims. */
+    int32 GetNumPrims() const { return PrimsByPath.Num(); }
+
+    /** @return The number of distinct prim names. */
+    int32 GetNumNames() const { return PathsByName.Num(); }
+
+    /** @return The time taken by the last full build, in seconds. */
+    double GetBuildTimeSeconds() const { return BuildTimeSeconds; }
+
+    /** @return The memory allocated by the index, in bytes. */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** Rebuilds the whole index from the stage's pseudo root. */
+    void Build(const UE::FUsdStage& Stage);
+
+    /** Adds the prim at the given path and all of its descendants to the index, where the traversal would visit them. */
+    void IndexSubtree(const UE::FUsdStage& Stage, const pxr::SdfPath& RootPath);
+
+    /** Removes the prim at the given path and all of its descendants from the index. */
+    void RemoveSubtree(const pxr::SdfPath& RootPath);
+
+    /** Adds a prim to the reverse index, under its parent. */
+    void AddIndexedPrim(const pxr::UsdPrim& Prim);
+
+    /** An indexed prim's name and indexed children, so removing a subtree only visits its own prims. */
+    struct FIndexedPrim
+    {
+        pxr::TfToken Name;
+        TArray<pxr::SdfPath> Children;
+    };
+
+    TMap<pxr::TfToken, TArray<pxr::SdfPath>, FDefaultSetAllocator, TUsdTokenKeyFuncs<TArray<pxr::SdfPath>>> PathsByName;
+    TMap<pxr::SdfPath, FIndexedPrim, FDefaultSetAllocator, TUsdPathKeyFuncs<FIndexedPrim>> PrimsByPath;
+    const void* StageIdentity = nullptr;
+    double BuildTimeSeconds = 0.0;
+};
+#endif
@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if USE_USD_SDK
+#include "Internationalization/Regex.h"
+
+#include "USDIncludesStart.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/stage.h"
+#include "USDIncludesEnd.h"
+
+#include <string>
+
+/**
+ * @brief A compiled prim address, as accepted by the PrimName parameter of the attribute getters.
+ *
+ * Prims can be addressed by:
+ * - A bare name, e.g. camera1, which finds the first prim with that name through the name index.
+ * - A name with * and ? wildcards, e.g. camera*, matched against every indexed prim name.
+ * - An absolute path, e.g. /CTRL_MASTER/shot010/camera1, which is looked up directly without any search.
+ * - An absolute path with wildcards, e.g. /CTRL_MASTER/shot???/camera*, where each segment is matched
+ *   against the children of the prims matched so far, and a ** segment matches any number of levels.
+ *   Consecutive ** segments are merged, and a prim reached through more than one ** is only reported once.
+ * - A regular expression prefixed with re:, e.g. re:^/CTRL_MASTER/.+/camera\d+$, searched for in every prim path.
+ *
+ * Wildcard paths only visit the branches that can still match, so a pattern with a literal prefix is
+ * far cheaper than a regular expression, which has to visit every prim on the stage.
+ *
+ * Patterns are compiled once and kept in a process wide cache, as they don't depend on the stage.
+ * Compiled patterns are immutable and can be matched from any thread.
+ */
+class USDATTRIBUTELIBRARY_API FUsdPrimPathPattern
+{
+public:
+    enum class EKind : uint8
+    {
+        Name,
+        NameWildcard,
+        Path,
+        PathWildcard,
+        Regex
+    };
+
+    /**
+     * @brief Finds how a prim address should be resolved without compiling it.
+     *
+     * @param Pattern The prim address.
+     * @return The kind of address.
+     */
+    static EKind Classify(const FString& Pattern);
+
+    /**
+     * @brief Returns the compiled form of a prim address, compiling and caching it on first use.
+     *
+     * @param Pattern The prim address.
+     * @return The compiled pattern.
+     */
+    static TSharedRef<const FUsdPrimPathPattern> FindOrCompile(const FString& Pattern);
+
+    /** @return The kind of address. */
+    EKind GetKind() const { return Kind; }
+
+    /** @return The path of a Path pattern. */
+    const pxr::SdfPath& GetPath() const { return Path; }
+
+    /**
+     * @brief Matches a prim name against a Name or NameWildcard pattern.
+     *
+     * @param Name The prim name.
+     * @return True if the name matches.
+     */
+    bool MatchesName(const pxr::TfToken& Name) const;
+
+    /**
+     * @brief Finds the prims matched by a Path, PathWildcard or Regex pattern.
+     *
+     * @param Stage The stage to search.
+     * @param OutPaths Receives the matching prim paths, in traversal order.
+     * @param bFirstOnly Whether to stop at the first match.
+     */
+    void FindMatches(const pxr::UsdStageRefPtr& Stage, TArray<pxr::SdfPath>& OutPaths, bool bFirstOnly) const;
+
+private:
+    explicit FUsdPrimPathPattern(const FString& Pattern);
+
+    /** One level of a PathWildcard pattern. */
+    struct FSegment
+    {
+        /** Set for segments without wildcards, which are found with a direct child lookup. */
+        pxr::TfToken Literal;
+        std::string Glob;
+        bool bAnyDepth = false;
+    };
+
+    /** @return True if the search should stop. */
+    bool MatchSegments(const pxr::UsdPrim& Prim, int32 SegmentIndex, TArray<pxr::SdfPath>& OutPaths, bool bFirstOnly) const;
+
+    EKind Kind = EKind::Name;
+    std::string Glob;
+    pxr::SdfPath Path;
+    TArray<FSegment> Segments;
+
+    /** Separate ** segments can reach the same prim along different routes, so their matches have to be deduplicated. */
+    int32 NumAnyDepthSegments = 0;
+    TOptional<FRegexPattern> Regex;
+};
+#endif
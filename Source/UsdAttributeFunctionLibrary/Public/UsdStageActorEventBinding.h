@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AUsdStageActor;
+
+/**
+ * @brief The bindings of one listener to a stage actor's events, so they can be removed together.
+ *
+ * Used by everything that follows a stage actor: the stage caches, the attribute subscriptions and the
+ * editor tools all rebuild on stage reloads, update on prim edits and drop their state when the actor is
+ * destroyed. Only the handlers that are set are bound.
+ *
+ * Unbind has to be called explicitly, as the bindings are copied around with the entries that own them.
+ * A handler may call it, including on the binding that is running it.
+ *
+ * Game thread only.
+ */
+class USDATTRIBUTELIBRARY_API FUsdStageActorEventBinding
+{
+public:
+    /** The handlers to bind, each of which is optional. */
+    struct FHandlers
+    {
+        /** Called when the stage actor opens a different stage, or closes its stage. */
+        TFunction<void()> OnStageChanged;
+
+        /** Called with the path of the changed prim or property, and whether the prim's subtree was recomposed. */
+        TFunction<void(const FString& PrimPath, bool bResync)> OnPrimChanged;
+
+        /** Called when the stage actor's time changes. */
+        TFunction<void()> OnTimeChanged;
+
+        /** Called when the stage actor is destroyed. */
+        TFunction<void()> OnActorDestroyed;
+    };
+
+    /**
+     * @brief Binds the handlers to the stage actor's events, first removing any earlier bindings.
+     *
+     * @param InStageActor The stage actor to follow.
+     * @param Handlers The handlers to call from its events.
+     */
+    void Bind(AUsdStageActor* InStageActor, FHandlers Handlers);
+
+    /** Removes the bindings from the stage actor, if it still exists. */
+    void Unbind();
+
+    /** @return True if the binding was made and the stage actor still exists. */
+    bool IsBound() const { return StageActor.IsValid(); }
+
+    /** @return The bound stage actor, or nullptr if there is none or it was destroyed. */
+    AUsdStageActor* GetStageActor() const { return StageActor.Get(); }
+
+private:
+    TWeakObjectPtr<AUsdStageActor> StageActor;
+    FDelegateHandle StageChangedHandle;
+    FDelegateHandle PrimChangedHandle;
+    FDelegateHandle TimeChangedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+};
@@ -10,8 +10,15 @@ public class UsdAttributeFunctionLibrary : ModuleRules
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
         
         
-        // Required to access from other modules
-        PublicDefinitions.Add("USDATTRIBUTELIBRARY_API=__declspec(dllexport)");
+        // Required to access from other modules. Outside Windows, alias the export macro UBT generates for this module
+        if (Target.Platform == UnrealTargetPlatform.Win64)
+        {
+            PublicDefinitions.Add("USDATTRIBUTELIBRARY_API=__declspec(dllexport)");
+        }
+        else
+        {
+            PublicDefinitions.Add("USDATTRIBUTELIBRARY_API=USDATTRIBUTEFUNCTIONLIBRARY_API");
+        }
         
         // Add public dependency modules
         PublicDependencyModuleNames.AddRange(
@@ -74,12 +81,7 @@ public class UsdAttributeFunctionLibrary : ModuleRules
             PublicSystemIncludePaths.Add(USDIncludeDir);
             PublicSystemLibraryPaths.Add(USDLibsDir);
 
-            foreach (string UsdLib in Directory.EnumerateFiles(USDLibsDir, "*.lib", SearchOption.AllDirectories))
-            {
-                PublicAdditionalLibraries.Add(UsdLib);
-            }
-
-            // Platform-specific Python and USD libraries setup
+            // Platform-specific Python and USD libraries setup (.lib import libraries on Win64, .so on Linux, .dylib on Mac)
             SetUpPlatformSpecificLibraries(Target, EngineDir);
         }
         else